@@ -1,73 +1,43 @@
-import os
-import sys
-import time
-import struct
-from serial.tools import list_ports
-from crc import Calculator, Crc8
-from serial import Serial
-from typing import Optional
-
-
-def find_usb_device(match_str: str) -> Optional[str]:
-    device_path: Optional[str] = None
-    devices = list_ports.comports()
-    for device in devices:
-        if match_str in device.description:
-            device_path = f"/dev/{device.name}"
-            break
-    return device_path
-
-if __name__ == "__main__":
-
-    # calc = Calculator(Crc8.SAEJ1850.value)
-    # data = bytearray([0x00])
-    # data.extend(bytearray(8))
-    # crc = calc.checksum(data)
-    # data.append(crc & 0xFF)
-    # dev = Serial(com_port, baudrate=115200)
-    # settings = dev.get_settings()
-    # settings["timeout"] = 1.0
-    # dev.apply_settings(settings)
-
-    # print(f"Sending data: {[hex(byte) for byte in data]}")
-    # t0 = time.perf_counter()
-    # dev.write(data)
-    # resp = dev.read(10)
-    # t1 = time.perf_counter()
-    # print(f"Message exchange took {round((t1 - t0) * 1e3, 3)} ms")
-    # ret_code = struct.unpack_from("<B", resp, 0)[0]
-    # pl1 = struct.unpack_from("<L", resp, 1)[0]
-    # pl2 = struct.unpack_from("<L", resp, 5)[0]
-    # recv_crc = struct.unpack_from("<B", resp, 9)[0]
-    # print(f"Retval: {hex(ret_code)}, Pl1: {hex(pl1)}, Pl2: {hex(pl2)}, CRC: {recv_crc} Calc CRC: {calc.checksum(resp[:9])}")
-    # print(f"Uptime: {pl1} [RTOS ticks]")
-    # print(f"RTOS ticks per second: {pl2} [RTOS ticks]")
-    # time.sleep(0.1)
-    # dev.close()
-
-
-    com_port = find_usb_device("STM32")
-    calc = Calculator(Crc8.SAEJ1850.value)
-    data = bytearray([0x01])
-    data.extend(bytearray(8))
-    crc = calc.checksum(data)
-    data.append(crc & 0xFF)
-    dev = Serial(com_port, baudrate=115200)
-    settings = dev.get_settings()
-    settings["timeout"] = 1.0
-    dev.apply_settings(settings)
-
-    print(f"Sending data: {[hex(byte) for byte in data]}")
-    t0 = time.perf_counter()
-    dev.write(data)
-    resp = dev.read(10)
-    t1 = time.perf_counter()
-    print(f"Message exchange took {round((t1 - t0) * 1e3, 3)} ms")
-    ret_code = struct.unpack_from("<B", resp, 0)[0]
-    pl1 = struct.unpack_from("<B", resp, 1)[0]
-    pl2 = struct.unpack_from("<B", resp, 2)[0]
-    recv_crc = struct.unpack_from("<B", resp, 9)[0]
-    print(f"Retval: {hex(ret_code)}, Pl1: {hex(pl1)}, Pl2: {hex(pl2)}, CRC: {recv_crc} Calc CRC: {calc.checksum(resp[:9])}")
-    time.sleep(0.1)
-    dev.close()
-
+import time
+import struct
+from serial.tools import list_ports
+from typing import Optional
+from protocol import ProtocolClient, SIGNAL_TICK_COUNT, SIGNAL_RESET_REASON
+
+
+def find_usb_device(match_str: str) -> Optional[str]:
+    device_path: Optional[str] = None
+    devices = list_ports.comports()
+    for device in devices:
+        if match_str in device.description:
+            device_path = f"/dev/{device.name}"
+            break
+    return device_path
+
+if __name__ == "__main__":
+
+    com_port = find_usb_device("STM32")
+    with ProtocolClient(com_port, baudrate=115200) as client:
+        t0 = time.perf_counter()
+        resp = client.request(0x00)
+        t1 = time.perf_counter()
+        print(f"Message exchange took {round((t1 - t0) * 1e3, 3)} ms")
+        ticks, ticks_per_second = struct.unpack_from("<LL", resp.payload, 0)
+        print(f"Retval: {hex(resp.id)}, Uptime: {ticks} [RTOS ticks], RTOS ticks per second: {ticks_per_second}")
+
+        resp = client.request(0x01)
+        print(f"Retval: {hex(resp.id)}, Reset reason: {hex(resp.payload[0])}")
+
+        client.subscribe(100, [SIGNAL_TICK_COUNT, SIGNAL_RESET_REASON])
+        for _ in range(10):
+            sample = client.read_telemetry()
+            print(f"Sampled at {sample.ticks} [RTOS ticks], Uptime: {sample.values[0]} [RTOS ticks], "
+                  f"Reset reason: {hex(sample.values[1])}")
+        client.subscribe(0, [])
+
+        t0 = time.perf_counter()
+        uptime, reset = client.batch([(0x00, b""), (0x01, b"")])
+        t1 = time.perf_counter()
+        print(f"Batched exchange took {round((t1 - t0) * 1e3, 3)} ms")
+        ticks, _ = struct.unpack_from("<LL", uptime.payload, 0)
+        print(f"Uptime: {ticks} [RTOS ticks], Reset reason: {hex(reset.payload[0])}")
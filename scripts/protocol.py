@@ -0,0 +1,196 @@
+import logging
+import struct
+import time
+from collections import deque
+from dataclasses import dataclass
+from pathlib import Path
+from crc import Calculator, Crc8
+from serial import Serial
+from cobs_codec import CobsCodec, CobsDecodeError
+
+
+logger = logging.getLogger(__name__)
+
+# Must match MSG_PAYLOAD_SIZE in stm32l476rg/app/protocol_cfg.h
+MAX_PAYLOAD_SIZE = 128
+FRAME_DELIMITER = b"\x00"
+
+ACK_RESPONSE = 0x00
+NACK_RESPONSE = 0x01
+CRC_ERROR_RESPONSE = 0x02
+INVALID_ID_RESPONSE = 0x04
+TELEMETRY_RESPONSE = 0x08
+
+UPTIME_ID = 0x00
+PROPOSE_BAUDRATE_ID = 0x04
+COMMIT_BAUDRATE_ID = 0x05
+BATCH_ID = 0x07
+SUBSCRIBE_ID = 0x08
+
+# Must match PROTOCOL_MAX_BAUD_ERROR_PPM & PROTOCOL_BAUD_CONFIRM_TIMEOUT_MS in stm32l476rg/app/protocol.c
+MAX_BAUD_ERROR_PPM = 10000
+BAUD_CONFIRM_TIMEOUT = 1.0
+BAUD_CONFIRM_RETRY_TIMEOUT = 0.1
+
+# Telemetry signal IDs, see MsgHandler_0x08 in stm32l476rg/app/msg_handler.c
+SIGNAL_TICK_COUNT = 0x00
+SIGNAL_RESET_REASON = 0x01
+SIGNAL_UART_ERROR_BASE = 0x02
+
+
+class ProtocolError(Exception):
+    pass
+
+
+@dataclass
+class Message:
+    id: int
+    payload: bytes
+
+
+@dataclass
+class Telemetry:
+    ticks: int
+    values: tuple[int, ...]
+
+
+class ProtocolClient:
+    """
+    Client of the firmware messaging protocol. Messages are sent as
+    [id][len][payload][crc], COBS encoded & terminated by a zero delimiter.
+    """
+    def __init__(
+            self,
+            port: str,
+            baudrate: int = 115200,
+            timeout: float = 1.0,
+            *,
+            dll_path: Path = Path("stm32l476rg/build/dlls/cobs_codec"),
+            debug: bool = False
+        ) -> None:
+
+        self._codec = CobsCodec(dll_path, debug=debug)
+        self._calc = Calculator(Crc8.SAEJ1850.value)
+        self._dev = Serial(port, baudrate=baudrate, timeout=timeout)
+        self._telemetry: deque[Message] = deque()
+
+    def __enter__(self) -> "ProtocolClient":
+        return self
+
+    def __exit__(self, *args) -> None:
+        self.close()
+
+    def close(self) -> None:
+        self._dev.close()
+
+    def send(self, msg_id: int, payload: bytes = b"") -> None:
+        if len(payload) > MAX_PAYLOAD_SIZE:
+            raise ValueError(f"Payload exceeds {MAX_PAYLOAD_SIZE} bytes")
+        raw = bytearray([msg_id, len(payload)])
+        raw.extend(payload)
+        raw.append(self._calc.checksum(raw) & 0xFF)
+        self._dev.write(self._codec.encode(raw))
+
+    def receive(self) -> Message:
+        frame = self._dev.read_until(FRAME_DELIMITER)
+        if not frame.endswith(FRAME_DELIMITER):
+            raise ProtocolError("Timed out waiting for a frame")
+        try:
+            raw = self._codec.decode(bytearray(frame))
+        except CobsDecodeError:
+            raise ProtocolError("Corrupted frame") from None
+        if len(raw) < 3 or raw[1] != len(raw) - 3:
+            raise ProtocolError(f"Invalid frame length: {len(raw)}")
+        if self._calc.checksum(raw[:-1]) & 0xFF != raw[-1]:
+            raise ProtocolError("CRC mismatch")
+        return Message(raw[0], bytes(raw[2:-1]))
+
+    def request(self, msg_id: int, payload: bytes = b"") -> Message:
+        """
+        Send a request & return its response, telemetry recieved meanwhile is kept
+        for read_telemetry().
+        """
+        self.send(msg_id, payload)
+        while True:
+            msg = self.receive()
+            if msg.id != TELEMETRY_RESPONSE:
+                return msg
+            self._telemetry.append(msg)
+
+    def switch_baudrate(self, baudrate: int, max_error_ppm: int = MAX_BAUD_ERROR_PPM) -> int:
+        """
+        Switch both sides to the given baud rate, returns the deviation of the device
+        baud rate in ppm. The rate is proposed & committed at the current baud rate,
+        the serial port is reconfigured once the commit response is recieved & the
+        switch is confirmed by a request at the new baud rate. Should the confirmation
+        fail the device reverts, so does the serial port.
+        """
+        resp = self.request(PROPOSE_BAUDRATE_ID, struct.pack("<L", baudrate))
+        _, error_ppm = struct.unpack_from("<Ll", resp.payload, 0)
+        if resp.id != ACK_RESPONSE or abs(error_ppm) > max_error_ppm:
+            raise ProtocolError(f"Baud rate {baudrate} rejected, deviation: {error_ppm} ppm")
+
+        resp = self.request(COMMIT_BAUDRATE_ID, struct.pack("<L", baudrate))
+        if resp.id != ACK_RESPONSE:
+            raise ProtocolError(f"Baud rate {baudrate} commit rejected: {hex(resp.id)}")
+        _, previous_baudrate = struct.unpack_from("<LL", resp.payload, 0)
+
+        # The device switches once the commit response is sent, bytes recieved
+        # meanwhile are garbled
+        deadline = time.monotonic() + BAUD_CONFIRM_TIMEOUT
+        self._dev.baudrate = baudrate
+        self._dev.reset_input_buffer()
+
+        # Any message confirms, retried as the device discards input while switching
+        timeout = self._dev.timeout
+        self._dev.timeout = BAUD_CONFIRM_RETRY_TIMEOUT
+        try:
+            while True:
+                try:
+                    self.request(UPTIME_ID)
+                    return error_ppm
+                except ProtocolError:
+                    if time.monotonic() >= deadline:
+                        self._dev.baudrate = previous_baudrate
+                        self._dev.reset_input_buffer()
+                        raise ProtocolError(f"Baud rate {baudrate} not confirmed, reverted") from None
+        finally:
+            self._dev.timeout = timeout
+
+    def subscribe(self, period_ms: int, signal_ids: list[int]) -> None:
+        """
+        Stream the given signals every period_ms, an empty list cancels the subscription.
+        """
+        resp = self.request(SUBSCRIBE_ID, struct.pack("<L", period_ms) + bytes(signal_ids))
+        if resp.id != ACK_RESPONSE:
+            raise ProtocolError(f"Subscription rejected: {hex(resp.id)}")
+        if not signal_ids:
+            self._telemetry.clear()
+
+    def read_telemetry(self) -> Telemetry:
+        msg = self._telemetry.popleft() if self._telemetry else self.receive()
+        if msg.id != TELEMETRY_RESPONSE or len(msg.payload) % 4 != 0:
+            raise ProtocolError(f"Unexpected message: {hex(msg.id)}")
+        ticks, *values = struct.unpack(f"<{len(msg.payload) // 4}L", msg.payload)
+        return Telemetry(ticks, tuple(values))
+
+    def batch(self, commands: list[tuple[int, bytes]]) -> list[Message]:
+        """
+        Send several commands in a single batch message, returns a response per
+        command dispatched. Commands not fitting the response are not dispatched.
+        """
+        payload = bytearray()
+        for msg_id, sub_payload in commands:
+            payload.extend([msg_id, len(sub_payload)])
+            payload.extend(sub_payload)
+        resp = self.request(BATCH_ID, bytes(payload))
+        if resp.id != ACK_RESPONSE:
+            raise ProtocolError(f"Batch rejected: {hex(resp.id)}")
+
+        responses = []
+        index = 0
+        while index + 2 <= len(resp.payload):
+            length = resp.payload[index + 1]
+            responses.append(Message(resp.payload[index], resp.payload[index + 2:index + 2 + length]))
+            index += 2 + length
+        return responses
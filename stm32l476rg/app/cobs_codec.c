@@ -10,10 +10,10 @@
 
 /* -------------------------- Public function definitions -------------------------- */
 
-CobsCodec_ResultType CobsCodec_Encode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen)
+RAMFUNC CobsCodec_ResultType CobsCodec_Encode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen)
 {
     U16 WriteIdx = 1U;
-    CobsCodec_ResultType Result = { .Length = 0UL, .Valid = False };
+    CobsCodec_ResultType Result = { .Length = 0U, .Valid = False };
 
     /* Verify that both pointers are valid & that the destination buffer is
     at least big enough to handle the minimum encoded data length. */
@@ -55,23 +55,22 @@ CobsCodec_ResultType CobsCodec_Encode(const U8* Src, U16 SrcLen, U8* Dst, U16 Ds
 
             if ( ReadIdx == SrcLen )
             {
-                /* Is there enough room in destination buffer to complete? */
-                if ( (WriteIdx + 2U) >= DstLen ) { break; }
+                /* Is there room in destination buffer for the zero delimiter? */
+                if ( WriteIdx >= DstLen ) { break; }
 
                 Dst[ControlByteIdx] = WriteIdx - ControlByteIdx;
-                WriteIdx++;
                 Dst[WriteIdx++] = 0x00U;
+                Result.Length = WriteIdx;
                 Result.Valid = True;
                 break;
             }
         }
     }
 
-    Result.Length = WriteIdx - 1U;
     return Result;
 }
 
-CobsCodec_ResultType CobsCodec_Decode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen)
+RAMFUNC CobsCodec_ResultType CobsCodec_Decode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen)
 {
     U16 WriteIdx = 0U;
     CobsCodec_ResultType Result = { .Length = 0U, .Valid = False };
@@ -27,7 +27,7 @@
 
 typedef struct
 {
-    U16 Length;
+    U16 Length;     /* Encoded length includes the zero delimiter, 0 if encoding failed. */
     Bool Valid;
 } CobsCodec_ResultType;
 
@@ -41,7 +41,7 @@ typedef struct
  * @param DstLen Capacity of output buffer.
  * @return Result of the encoding operation.
  */
-DLLEXPORT CobsCodec_ResultType CobsCodec_Encode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen);
+DLLEXPORT RAMFUNC CobsCodec_ResultType CobsCodec_Encode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen);
 
 /**
  * @brief Decode the given data.
@@ -51,6 +51,6 @@ DLLEXPORT CobsCodec_ResultType CobsCodec_Encode(const U8* Src, U16 SrcLen, U8* D
  * @param DstLen Capacity of output buffer.
  * @return Result of the decoding operation.
  */
-DLLEXPORT CobsCodec_ResultType CobsCodec_Decode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen);
+DLLEXPORT RAMFUNC CobsCodec_ResultType CobsCodec_Decode(const U8* Src, U16 SrcLen, U8* Dst, U16 DstLen);
 
 #endif /* COBS_CODEC_H */
@@ -16,12 +16,14 @@
 #include "digital.h"
 #include "uart.h"
 #include "crc.h"
+#include "dma.h"
 #include "protocol.h"
 #include "exti.h"
 #include "mempool.h"
 #include "osal.h"
 #include "core_debug.h"
 #include "limit.h"
+#include "startup.h"
 
 /* ----------------------------------- Move this! ---------------------------------- */
 
@@ -115,17 +117,23 @@ void CommThreadFunc(void* Arg);
 int main(void)
 {
     Setup();
+    Startup_SetBootTimestamp(BOOT_STAGE_SETUP);
     MemPool_Init();
+    Startup_SetBootTimestamp(BOOT_STAGE_MEMPOOL_INIT);
+    Dma_Init();
     Crc_Enable();
     Crc_Crc8ConfigType Crc8Cfg = Crc_GetSAEJ1850Config();
     Crc_Crc8Init(&Crc8Cfg);
+    Startup_SetBootTimestamp(BOOT_STAGE_CRC_INIT);
     Protocol_Init(USART2, 115200, PIN_A2, PIN_A3);
+    Startup_SetBootTimestamp(BOOT_STAGE_PROTOCOL_INIT);
 
     Digital_OutputInit(&OutputA5);
     RotEnc_Init(&Encoder, PIN_A0, PIN_A1, True);
 
     Osal_ThreadCreate(BlinkThreadFunc, NULL, 1024, THREAD_PRIORITY_MEDIUM);
     Osal_ThreadCreate(CommThreadFunc, NULL, 1024, THREAD_PRIORITY_MEDIUM);
+    Startup_SetBootTimestamp(BOOT_STAGE_SCHEDULER_START);
     Osal_StartScheduler();
 
     while (1)
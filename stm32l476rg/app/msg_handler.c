@@ -10,6 +10,29 @@
 #include "crc.h"
 #include "osal.h"
 #include "watchdog.h"
+#include "startup.h"
+#include "protocol.h"
+#include "memory_routines.h"
+
+/* ------------------------- Local preprocessor definitions ------------------------ */
+
+/**
+ * @brief Payload size of the responses with a fixed layout.
+ */
+#define MSG_HANDLER_REPLY_SIZE  (8U)
+
+/**
+ * @brief ID of the batch message, sub-commands & sub-responses are [ID][Length][Payload].
+ */
+#define MSG_HANDLER_BATCH_ID    (0x07U)
+
+/**
+ * @brief Size of the sample timestamp & of each signal value in telemetry messages.
+ */
+#define MSG_HANDLER_SIGNAL_SIZE (4U)
+
+StaticAssert((MSG_HANDLER_SIGNAL_SIZE * (PROTOCOL_MAX_NOF_SIGNALS + 1U)) <= MSG_PAYLOAD_SIZE,
+             "Telemetry exceeds MSG_PAYLOAD_SIZE");
 
 /*  ----------------- Structures, enumerations & type definitions ------------------ */
 
@@ -18,6 +41,15 @@
  */
 typedef void (*MessageHandler)(const Protocol_MessageType*, Protocol_MessageType*);
 
+/**
+ * @brief Telemetry signal, read by calling Reader with Arg.
+ */
+typedef struct
+{
+    U32 (*Reader)(U8 Arg);
+    U8 Arg;
+} MsgHandler_SignalType;
+
 /* --------------------------- Private function prototypes ------------------------- */
 
 /**
@@ -26,7 +58,7 @@ typedef void (*MessageHandler)(const Protocol_MessageType*, Protocol_MessageType
 void DummyMessageHandler(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
 
 /**
- * @brief Calculate the CRC-8 for the given message.
+ * @brief Calculate the CRC-8 for the given message, covering the header & valid payload bytes.
  * @param Message Pointer to message structure.
  * @return CRC-8 digest.
  */
@@ -44,6 +76,15 @@ void MsgHandler_ConstructCrcErrorResponse(Protocol_MessageType* TxMsg);
  */
 void MsgHandler_ConstructMsgIdErrorResponse(Protocol_MessageType* TxMsg);
 
+/**
+ * @brief Telemetry signal readers.
+ * @param Arg Signal specific argument.
+ * @return Signal value.
+ */
+U32 MsgHandler_ReadTickCount(U8 Arg);
+U32 MsgHandler_ReadResetReason(U8 Arg);
+U32 MsgHandler_ReadUartErrorCount(U8 Arg);
+
 /**
  * @brief Handler for message with ID: 0x00. 
  *        Get the current value of the RTOS tick counter &
@@ -57,6 +98,72 @@ void MsgHandler_0x00(const Protocol_MessageType* RxMsg, Protocol_MessageType* Tx
  */
 void MsgHandler_0x01(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
 
+/**
+ * @brief Handler for message with ID: 0x02.
+ *        Get the boot stage timestamp requested by the first payload byte.
+ *        Responds with the stage, the number of stages & the stage timestamp
+ *        in number of core clock cycles since reset at payload offset 4.
+ */
+void MsgHandler_0x02(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
+/**
+ * @brief Handler for message with ID: 0x03.
+ *        Get the protocol UART reception error counter requested by the first payload byte.
+ *        Responds with the counter index, the number of counters & the count
+ *        at payload offset 4.
+ */
+void MsgHandler_0x03(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
+/**
+ * @brief Handler for message with ID: 0x04.
+ *        Propose the baud rate given at payload offset 0. Responds with the
+ *        baud rate & the expected deviation in parts per million at payload offset 4,
+ *        NACK if the baud rate is not attainable within tolerance.
+ */
+void MsgHandler_0x04(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
+/**
+ * @brief Handler for message with ID: 0x05.
+ *        Commit the previously proposed baud rate given at payload offset 0. The
+ *        response is sent at the current baud rate, after which the device switches &
+ *        the host reconfigures its port, see ProtocolClient.switch_baudrate().
+ *        Responds with the committed baud rate & the previous one at payload offset 4,
+ *        NACK if there is no matching proposal.
+ */
+void MsgHandler_0x05(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
+/**
+ * @brief Handler for message with ID: 0x06.
+ *        Get the request latency histogram bin of the stage requested by the first
+ *        & second payload byte, bin PROTOCOL_LATENCY_NOF_BINS selects the longest
+ *        latency in microseconds. Responds with the stage, the bin, the number of bins
+ *        & the number of stages, followed by the count or latency at payload offset 4.
+ *        Stage PROTOCOL_LATENCY_ENUM_LIMIT clears all histograms, NACK if disabled.
+ */
+void MsgHandler_0x06(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
+/**
+ * @brief Handler for message with ID: 0x07.
+ *        Batch of sub-commands, each [ID][Length][Payload], dispatched in order.
+ *        Responds with a sub-response [ID][Length][Payload] per sub-command. A sub-command
+ *        is only dispatched while a MSG_HANDLER_REPLY_SIZE sub-response still fits,
+ *        the remaining ones are skipped. Nested batches are rejected with an invalid
+ *        ID sub-response, NACK without sub-responses if a sub-command is truncated.
+ */
+void MsgHandler_0x07(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
+/**
+ * @brief Handler for message with ID: 0x08.
+ *        Subscribe to telemetry with the period in milliseconds given at payload
+ *        offset 0, streaming the signals whose IDs follow from payload offset 4.
+ *        Signals: 0x00 = RTOS tick count, 0x01 = reset reason, 0x02 + n = count of
+ *        protocol UART reception error n. A period of 0 or no signals cancels the
+ *        subscription. Responds with the period, the number of signals subscribed
+ *        & the number of signals available, NACK if a signal is unknown, there are
+ *        more than PROTOCOL_MAX_NOF_SIGNALS or the period is too short.
+ */
+void MsgHandler_0x08(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
+
 /* --------------------------------- Local variables ------------------------------- */
 
 /**
@@ -64,10 +171,33 @@ void MsgHandler_0x01(const Protocol_MessageType* RxMsg, Protocol_MessageType* Tx
  */
 static const MessageHandler MsgHandlerTable[] =
 {
-    MsgHandler_0x00, MsgHandler_0x01
+    MsgHandler_0x00, MsgHandler_0x01, MsgHandler_0x02, MsgHandler_0x03,
+    MsgHandler_0x04, MsgHandler_0x05, MsgHandler_0x06, MsgHandler_0x07,
+    MsgHandler_0x08
 };
 static const U8 NofMsgHandlers = (U8)(sizeof(MsgHandlerTable) / sizeof(MsgHandlerTable[0]));
 
+/**
+ * @brief Telemetry signal table, indexed by signal ID.
+ */
+static const MsgHandler_SignalType SignalTable[] =
+{
+    { MsgHandler_ReadTickCount, 0U },
+    { MsgHandler_ReadResetReason, 0U },
+    { MsgHandler_ReadUartErrorCount, (U8)UART_ERROR_DROP },
+    { MsgHandler_ReadUartErrorCount, (U8)UART_ERROR_OVERRUN },
+    { MsgHandler_ReadUartErrorCount, (U8)UART_ERROR_FRAMING },
+    { MsgHandler_ReadUartErrorCount, (U8)UART_ERROR_NOISE },
+    { MsgHandler_ReadUartErrorCount, (U8)UART_ERROR_PARITY }
+};
+static const U8 NofTelemetrySignals = (U8)(sizeof(SignalTable) / sizeof(SignalTable[0]));
+
+/**
+ * @brief Sub-command & sub-response of the batch being handled.
+ */
+static Protocol_MessageType BatchRxMsg = { 0 };
+static Protocol_MessageType BatchTxMsg = { 0 };
+
 /* --------------------------- Private function definitions ------------------------ */
 
 void DummyMessageHandler(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
@@ -78,27 +208,36 @@ void DummyMessageHandler(const Protocol_MessageType* RxMsg, Protocol_MessageType
 
 U8 MsgHandler_CalcCrc(const Protocol_MessageType* Message)
 {
-    return Crc_CalcCrc8((const U8*)Message, (MSG_ID_SIZE + MSG_PAYLOAD_SIZE));
+    return Crc_CalcCrc8((const U8*)Message, (U8)(MSG_HEADER_SIZE + Message->Length));
 }
 
 void MsgHandler_ConstructCrcErrorResponse(Protocol_MessageType* TxMsg)
 {
     TxMsg->Id = CRC_ERROR_RESPONSE;
-    for (U8 i = 0; i < MSG_PAYLOAD_SIZE; i++)
-    {
-        TxMsg->Payload[i] = 0;
-    }
-    TxMsg->Crc = MsgHandler_CalcCrc(TxMsg);
+    TxMsg->Length = 0U;
 }
 
 void MsgHandler_ConstructMsgIdErrorResponse(Protocol_MessageType* TxMsg)
 {
     TxMsg->Id = INVALID_ID_RESPONSE;
-    for (U8 i = 0; i < MSG_PAYLOAD_SIZE; i++)
-    {
-        TxMsg->Payload[i] = 0;
-    }
-    TxMsg->Crc = MsgHandler_CalcCrc(TxMsg);
+    TxMsg->Length = 0U;
+}
+
+U32 MsgHandler_ReadTickCount(U8 Arg)
+{
+    UNUSED(Arg);
+    return Osal_GetTickCount();
+}
+
+U32 MsgHandler_ReadResetReason(U8 Arg)
+{
+    UNUSED(Arg);
+    return (U32)Wdg_ReadResetReason();
+}
+
+U32 MsgHandler_ReadUartErrorCount(U8 Arg)
+{
+    return Uart_GetErrorCount(Protocol_GetUartHandle(), (Uart_ErrorEnum)Arg);
 }
 
 /* ------------------------ Message handler function definitions -------------------- */
@@ -108,9 +247,9 @@ void MsgHandler_0x00(const Protocol_MessageType* RxMsg, Protocol_MessageType* Tx
     UNUSED(RxMsg);
 
     TxMsg->Id = ACK_RESPONSE;
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
     *((U32*)(&TxMsg->Payload[0])) = Osal_GetTickCount();
     *((U32*)(&TxMsg->Payload[4])) = Osal_msToTicks(1000);
-    TxMsg->Crc = MsgHandler_CalcCrc(TxMsg);
 }
 
 void MsgHandler_0x01(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
@@ -118,13 +257,184 @@ void MsgHandler_0x01(const Protocol_MessageType* RxMsg, Protocol_MessageType* Tx
     UNUSED(RxMsg);
 
     TxMsg->Id = ACK_RESPONSE;
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
     TxMsg->Payload[0] = Wdg_ReadResetReason();
-    for (U8 i = 1; i < MSG_PAYLOAD_SIZE; i++)
+    for (U8 i = 1; i < MSG_HANDLER_REPLY_SIZE; i++)
     {
         TxMsg->Payload[i] = 0x00U;
     }
+}
 
-    TxMsg->Crc = MsgHandler_CalcCrc(TxMsg);
+void MsgHandler_0x02(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    const Startup_BootStageEnum Stage = (Startup_BootStageEnum)RxMsg->Payload[0];
+
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
+    for (U8 i = 0; i < MSG_HANDLER_REPLY_SIZE; i++)
+    {
+        TxMsg->Payload[i] = 0x00U;
+    }
+
+    if (Stage < BOOT_STAGE_ENUM_LIMIT)
+    {
+        TxMsg->Id = ACK_RESPONSE;
+        TxMsg->Payload[0] = (U8)Stage;
+        TxMsg->Payload[1] = (U8)BOOT_STAGE_ENUM_LIMIT;
+        *((U32*)(&TxMsg->Payload[4])) = Startup_GetBootTimestamp(Stage);
+    }
+    else
+    {
+        TxMsg->Id = NACK_RESPONSE;
+    }
+}
+
+void MsgHandler_0x03(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    const Uart_ErrorEnum Error = (Uart_ErrorEnum)RxMsg->Payload[0];
+
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
+    for (U8 i = 0; i < MSG_HANDLER_REPLY_SIZE; i++)
+    {
+        TxMsg->Payload[i] = 0x00U;
+    }
+
+    if (Error < UART_ERROR_ENUM_LIMIT)
+    {
+        TxMsg->Id = ACK_RESPONSE;
+        TxMsg->Payload[0] = (U8)Error;
+        TxMsg->Payload[1] = (U8)UART_ERROR_ENUM_LIMIT;
+        *((U32*)(&TxMsg->Payload[4])) = Uart_GetErrorCount(Protocol_GetUartHandle(), Error);
+    }
+    else
+    {
+        TxMsg->Id = NACK_RESPONSE;
+    }
+}
+
+void MsgHandler_0x04(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    const U32 BaudRate = *((const U32*)(&RxMsg->Payload[0]));
+    S32 BaudError_ppm = 0;
+
+    TxMsg->Id = (Protocol_ProposeBaudRate(BaudRate, &BaudError_ppm) == RC_OK) ? ACK_RESPONSE : NACK_RESPONSE;
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
+    *((U32*)(&TxMsg->Payload[0])) = BaudRate;
+    *((S32*)(&TxMsg->Payload[4])) = BaudError_ppm;
+}
+
+void MsgHandler_0x05(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    const U32 BaudRate = *((const U32*)(&RxMsg->Payload[0]));
+
+    TxMsg->Id = (Protocol_CommitBaudRate(BaudRate) == RC_OK) ? ACK_RESPONSE : NACK_RESPONSE;
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
+    *((U32*)(&TxMsg->Payload[0])) = BaudRate;
+    *((U32*)(&TxMsg->Payload[4])) = Protocol_GetBaudRate();
+}
+
+void MsgHandler_0x06(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
+    for (U8 i = 0; i < MSG_HANDLER_REPLY_SIZE; i++)
+    {
+        TxMsg->Payload[i] = 0x00U;
+    }
+    TxMsg->Id = NACK_RESPONSE;
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    const Protocol_LatencyStageEnum Stage = (Protocol_LatencyStageEnum)RxMsg->Payload[0];
+    const U8 Bin = RxMsg->Payload[1];
+
+    if (Stage == PROTOCOL_LATENCY_ENUM_LIMIT)
+    {
+        Protocol_ClearLatencyHistogram();
+        TxMsg->Id = ACK_RESPONSE;
+    }
+    else if ( (Stage < PROTOCOL_LATENCY_ENUM_LIMIT) && (Bin <= PROTOCOL_LATENCY_NOF_BINS) )
+    {
+        TxMsg->Id = ACK_RESPONSE;
+        *((U32*)(&TxMsg->Payload[4])) = (Bin == PROTOCOL_LATENCY_NOF_BINS) ?
+                                        Protocol_GetLatencyMax_us(Stage) : Protocol_GetLatencyCount(Stage, Bin);
+    }
+    TxMsg->Payload[0] = (U8)Stage;
+    TxMsg->Payload[1] = Bin;
+    TxMsg->Payload[2] = (U8)PROTOCOL_LATENCY_NOF_BINS;
+    TxMsg->Payload[3] = (U8)PROTOCOL_LATENCY_ENUM_LIMIT;
+#else
+    (void)RxMsg;
+#endif /* UART_TIMESTAMP_ENABLE */
+}
+
+void MsgHandler_0x07(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    /* Validate the layout first, no sub-command is dispatched from a malformed batch */
+    U16 RxIndex = 0U;
+    while (RxIndex < RxMsg->Length)
+    {
+        if ((RxIndex + MSG_HEADER_SIZE) > RxMsg->Length) { break; }
+        RxIndex += MSG_HEADER_SIZE + RxMsg->Payload[RxIndex + MSG_ID_SIZE];
+    }
+    if (RxIndex != RxMsg->Length)
+    {
+        TxMsg->Id = NACK_RESPONSE;
+        TxMsg->Length = 0U;
+        return;
+    }
+
+    /* Handlers reply with at most MSG_HANDLER_REPLY_SIZE bytes, a sub-command is only
+       dispatched while such a sub-response fits */
+    U16 TxIndex = 0U;
+    RxIndex = 0U;
+    while ( (RxIndex < RxMsg->Length) &&
+            ((TxIndex + MSG_HEADER_SIZE + MSG_HANDLER_REPLY_SIZE) <= MSG_PAYLOAD_SIZE) )
+    {
+        /* Handlers read fixed payload offsets, pad the sub-command payload with zeros */
+        BatchRxMsg.Id = RxMsg->Payload[RxIndex];
+        BatchRxMsg.Length = RxMsg->Payload[RxIndex + MSG_ID_SIZE];
+        memset(BatchRxMsg.Payload, 0, MSG_PAYLOAD_SIZE);
+        memcpy(BatchRxMsg.Payload, &RxMsg->Payload[RxIndex + MSG_HEADER_SIZE], BatchRxMsg.Length);
+        RxIndex += MSG_HEADER_SIZE + BatchRxMsg.Length;
+
+        if ( (BatchRxMsg.Id < NofMsgHandlers) && (BatchRxMsg.Id != MSG_HANDLER_BATCH_ID) )
+        {
+            MsgHandlerTable[BatchRxMsg.Id](&BatchRxMsg, &BatchTxMsg);
+        }
+        else
+        {
+            MsgHandler_ConstructMsgIdErrorResponse(&BatchTxMsg);
+        }
+
+        TxMsg->Payload[TxIndex] = BatchTxMsg.Id;
+        TxMsg->Payload[TxIndex + MSG_ID_SIZE] = BatchTxMsg.Length;
+        memcpy(&TxMsg->Payload[TxIndex + MSG_HEADER_SIZE], BatchTxMsg.Payload, BatchTxMsg.Length);
+        TxIndex += MSG_HEADER_SIZE + BatchTxMsg.Length;
+    }
+
+    TxMsg->Id = ACK_RESPONSE;
+    TxMsg->Length = (U8)TxIndex;
+}
+
+void MsgHandler_0x08(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    const U32 Period_ms = *((const U32*)(&RxMsg->Payload[0]));
+    const U8 NofSubscribed = (RxMsg->Length > MSG_HANDLER_SIGNAL_SIZE) ?
+                             (U8)(RxMsg->Length - MSG_HANDLER_SIGNAL_SIZE) : 0U;
+    const U8* const SignalIds = &RxMsg->Payload[MSG_HANDLER_SIGNAL_SIZE];
+
+    Bool Valid = True;
+    for (U8 i = 0; i < NofSubscribed; i++)
+    {
+        if (SignalIds[i] >= NofTelemetrySignals) { Valid = False; }
+    }
+    if (Valid) { Valid = (Protocol_Subscribe(Period_ms, SignalIds, NofSubscribed) == RC_OK); }
+
+    TxMsg->Id = Valid ? ACK_RESPONSE : NACK_RESPONSE;
+    TxMsg->Length = MSG_HANDLER_REPLY_SIZE;
+    *((U32*)(&TxMsg->Payload[0])) = Period_ms;
+    TxMsg->Payload[4] = NofSubscribed;
+    TxMsg->Payload[5] = NofTelemetrySignals;
+    TxMsg->Payload[6] = 0x00U;
+    TxMsg->Payload[7] = 0x00U;
 }
 
 /* -------------------------- Public function definitions -------------------------- */
@@ -142,4 +452,19 @@ void MsgHandler_HandleMessage(const Protocol_MessageType* RxMsg, Protocol_Messag
         MsgHandlerTable[RxMsg->Id](RxMsg, TxMsg);
     }
 
+    TxMsg->Crc = MsgHandler_CalcCrc(TxMsg);
+}
+
+void MsgHandler_ConstructTelemetry(const U8* SignalIds, U8 NofSignals, Protocol_MessageType* TxMsg)
+{
+    TxMsg->Id = TELEMETRY_RESPONSE;
+    TxMsg->Length = (U8)(MSG_HANDLER_SIGNAL_SIZE * (NofSignals + 1U));
+    *((U32*)(&TxMsg->Payload[0])) = Osal_GetTickCount();
+    for (U8 i = 0; i < NofSignals; i++)
+    {
+        const U8 Id = SignalIds[i];
+        *((U32*)(&TxMsg->Payload[MSG_HANDLER_SIGNAL_SIZE * (i + 1U)])) =
+            (Id < NofTelemetrySignals) ? SignalTable[Id].Reader(SignalTable[Id].Arg) : 0U;
+    }
+    TxMsg->Crc = MsgHandler_CalcCrc(TxMsg);
 }
@@ -15,10 +15,19 @@
 /* -------------------------- Public function prototypes --------------------------- */
 
 /**
- * @brief Handle the given message & assemble the given response message.
+ * @brief Handle the given message & assemble the given response message, CRC included.
  * @param RxMsg Recived message to be handled.
  * @param TxMsg Response message to be assembled.
  */
 void MsgHandler_HandleMessage(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg);
 
+/**
+ * @brief Assemble a telemetry message, CRC included. The payload holds the RTOS tick
+ *        count at sampling followed by the 32-bit value of each signal, see MsgHandler_0x08.
+ * @param SignalIds Signals to sample, unknown signals read as 0.
+ * @param NofSignals Number of signals.
+ * @param TxMsg Telemetry message to be assembled.
+ */
+void MsgHandler_ConstructTelemetry(const U8* SignalIds, U8 NofSignals, Protocol_MessageType* TxMsg);
+
 #endif /* MSG_HANDLER_H */
@@ -9,32 +9,454 @@
 #include "protocol.h"
 #include "protocol_cfg.h"
 #include "msg_handler.h"
+#include "cobs_codec.h"
+#include "memory_routines.h"
+#include "osal.h"
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+#include "core_debug.h"
+#include "clock_control.h"
+#endif /* UART_TIMESTAMP_ENABLE */
 
+/* ------------------------- Local preprocessor definitions ------------------------ */
+/**
+ * @brief Number of bytes fetched from the UART at once, bytes past the end of a frame
+ *        are kept for the next one.
+ */
+#define PROTOCOL_RX_CHUNK_SIZE              (32U)
+
+/**
+ * @brief Largest accepted baud rate deviation, leaving the remainder of the
+ *        receiver tolerance to the host.
+ */
+#define PROTOCOL_MAX_BAUD_ERROR_PPM         (10000)
+
+/**
+ * @brief Time within which a message has to be recieved at a new baud rate,
+ *        otherwise the previous baud rate is restored.
+ */
+#define PROTOCOL_BAUD_CONFIRM_TIMEOUT_MS    (1000U)
+
+#define PROTOCOL_IS_POWER_OF_TWO(Value)     ( ((Value) != 0U) && (((Value) & ((Value) - 1U)) == 0U) )
+
+StaticAssert(PROTOCOL_IS_POWER_OF_TWO(PROTOCOL_RX_QUEUE_LENGTH), "PROTOCOL_RX_QUEUE_LENGTH must be a power of two");
+StaticAssert(PROTOCOL_IS_POWER_OF_TWO(PROTOCOL_TX_QUEUE_LENGTH), "PROTOCOL_TX_QUEUE_LENGTH must be a power of two");
+StaticAssert(PROTOCOL_UART_BUFFER_SIZE >= MSG_FRAME_SIZE, "PROTOCOL_UART_BUFFER_SIZE below frame size");
+
+/*  -------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Baud rate switch states.
+ */
+typedef enum
+{
+    PROTOCOL_BAUD_IDLE = 0x0U,      /* No switch in progress */
+    PROTOCOL_BAUD_PROPOSED = 0x1U,  /* Baud rate proposed by host & accepted */
+    PROTOCOL_BAUD_COMMITTED = 0x2U, /* Switch upon transmission of the commit response */
+    PROTOCOL_BAUD_CONFIRM = 0x3U,   /* Switched, awaiting first message at the new baud rate */
+    PROTOCOL_BAUD_SWITCHING = 0x4U, /* Commit response queued, switch awaits its transmission */
+    PROTOCOL_BAUD_REVERTING = 0x5U  /* Unconfirmed, switch back awaits end of transmission */
+} Protocol_BaudSwitchEnum;
+
+/**
+ * @brief Bounded queue of pipeline entries, the entries are stored in an array.
+ */
+typedef struct
+{
+    U8 Head;    /* Index of the oldest entry. */
+    U8 Count;
+} Protocol_QueueType;
+
+/**
+ * @brief Recieved request awaiting handling.
+ */
+typedef struct
+{
+    Protocol_MessageType Message;
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    U32 RxTimestamp;
+#endif /* UART_TIMESTAMP_ENABLE */
+} Protocol_RequestType;
+
+/**
+ * @brief Response awaiting transmission.
+ */
+typedef struct
+{
+    Protocol_MessageType Message;
+    Bool SwitchBaudRate;    /* Response to a baud rate commit, switch once written. */
+    Bool Telemetry;         /* Unsolicited, latency not measured. */
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    U32 RxTimestamp;
+    U32 HandlerEnd;
+#endif /* UART_TIMESTAMP_ENABLE */
+} Protocol_ResponseType;
+
+/**
+ * @brief Telemetry subscription of the link.
+ */
+typedef struct
+{
+    U8 SignalIds[PROTOCOL_MAX_NOF_SIGNALS];
+    U8 NofSignals;          /* 0 = not subscribed. */
+    U32 Period;             /* Telemetry period in OS ticks. */
+    U32 NextSample;         /* OS tick count of the next sample. */
+} Protocol_SubscriptionType;
+
+/**
+ * @brief Latency histogram of one request handling stage.
+ */
+typedef struct
+{
+    U32 Counts[PROTOCOL_LATENCY_NOF_BINS];
+    U32 Max_us;
+} Protocol_LatencyHistogramType;
 
 /* --------------------------------- Local variables ------------------------------- */
 static Bool ProtocolInitialized = False;
 static Uart_HandleType UartHandle = NULL;
-static Protocol_MessageType TxMsg = { 0 };
-static Protocol_MessageType RxMsg = { 0 };
+static U8 UartRxBuffer[PROTOCOL_UART_BUFFER_SIZE] = { 0 };
+static U8 UartTxBuffer[PROTOCOL_UART_BUFFER_SIZE] = { 0 };
+static Protocol_RequestType Requests[PROTOCOL_RX_QUEUE_LENGTH] = { 0 };
+static Protocol_ResponseType Responses[PROTOCOL_TX_QUEUE_LENGTH] = { 0 };
+static Protocol_QueueType RxQueue = { 0 };
+static Protocol_QueueType TxQueue = { 0 };
+static U8 RxChunk[PROTOCOL_RX_CHUNK_SIZE] = { 0 };
+static U16 RxChunkLength = 0U;
+static U16 RxChunkIndex = 0U;
+static U8 RxFrame[MSG_FRAME_SIZE] = { 0 };
+static U16 RxFrameLength = 0U;
+static Bool RxFrameOverflow = False;    /* Frame exceeds the buffer, dropped at its delimiter. */
+static U8 DecodeBuffer[MSG_FRAME_SIZE] = { 0 };
+static U8 TxFrame[MSG_FRAME_SIZE] = { 0 };
+static U16 TxFrameLength = 0U;          /* Encoded response awaiting room in the output buffer. */
+static Protocol_BaudSwitchEnum BaudSwitchState = PROTOCOL_BAUD_IDLE;
+static U32 CurrentBaudRate = 0U;
+static U32 ProposedBaudRate = 0U;
+static U32 PreviousBaudRate = 0U;
+static U32 ConfirmDeadline = 0U;        /* OS tick count at which an unconfirmed switch is reverted. */
+static Protocol_SubscriptionType Subscription = { 0 };
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+static Protocol_LatencyHistogramType LatencyHistograms[PROTOCOL_LATENCY_ENUM_LIMIT] = { 0 };
+static U32 CyclesPerUs = 1U;
+static Bool TxLatencyPending = False;   /* Awaiting transmission complete of the last response. */
+static U32 PendingRxTimestamp = 0U;
+static U32 PendingHandlerEnd = 0U;
+#endif /* UART_TIMESTAMP_ENABLE */
 
 /* -------------------------- Private function definitions ------------------------- */
 
 /**
- * @brief Recieve a message.
+ * @brief Decode the frame in the frame buffer into the given message.
  * @param Message Pointer to message structure.
+ * @param FrameLength Length of the frame, delimiter included.
+ * @return True = valid message, False = corrupted frame.
+ */
+static Bool Protocol_DecodeFrame(Protocol_MessageType* Message, U16 FrameLength)
+{
+    /* Decoded data never exceeds the encoded length, the buffers are equally sized */
+    const CobsCodec_ResultType Result = CobsCodec_Decode(RxFrame, FrameLength, DecodeBuffer, sizeof(DecodeBuffer));
+    if ( !Result.Valid || (Result.Length < (MSG_HEADER_SIZE + MSG_CRC_SIZE)) ) { return False; }
+
+    const U8 PayloadLength = DecodeBuffer[MSG_ID_SIZE];
+    if ( (PayloadLength > MSG_PAYLOAD_SIZE) ||
+         (Result.Length != (MSG_HEADER_SIZE + PayloadLength + MSG_CRC_SIZE)) )
+    {
+        return False;
+    }
+
+    Message->Id = DecodeBuffer[0];
+    Message->Length = PayloadLength;
+    memcpy(Message->Payload, &DecodeBuffer[MSG_HEADER_SIZE], PayloadLength);
+    memset(&Message->Payload[PayloadLength], 0x00U, MSG_PAYLOAD_SIZE - PayloadLength);
+    Message->Crc = DecodeBuffer[MSG_HEADER_SIZE + PayloadLength];
+    return True;
+}
+
+/**
+ * @brief Recieve a message, bytes are collected up to the next frame delimiter.
+ *        Frames failing to decode are dropped.
+ * @param Message Pointer to message structure.
+ * @param Timeout_ms Timeout in milliseconds, OSAL_WAIT_FOREVER to wait indefinitely.
  * @return True = message was recieved, false = something went wrong.
  */
-static Bool Protocol_RecieveMessage(Protocol_MessageType* Message)
+static Bool Protocol_RecieveMessage(Protocol_MessageType* Message, U32 Timeout_ms)
 {
-    return Uart_Recieve(UartHandle, (U8*)Message, MSG_SIZE);
+    for (;;)
+    {
+        while (RxChunkIndex < RxChunkLength)
+        {
+            const U8 Byte = RxChunk[RxChunkIndex++];
+            if (Byte != MSG_FRAME_DELIMITER)
+            {
+                /* Room for the delimiter is kept */
+                if (RxFrameLength < (MSG_FRAME_SIZE - 1U)) { RxFrame[RxFrameLength++] = Byte; }
+                else { RxFrameOverflow = True; }
+                continue;
+            }
+
+            RxFrame[RxFrameLength++] = Byte;
+            const U16 FrameLength = RxFrameLength;
+            const Bool Complete = !RxFrameOverflow && (FrameLength > 1U);
+            RxFrameLength = 0U;
+            RxFrameOverflow = False;
+            if ( Complete && Protocol_DecodeFrame(Message, FrameLength) ) { return True; }
+        }
+
+        /* The reader is woken early by the delimiter, see Protocol_Init() */
+        RxChunkIndex = 0U;
+        RxChunkLength = Uart_ReadTimeout(UartHandle, RxChunk, PROTOCOL_RX_CHUNK_SIZE, Timeout_ms);
+        if (RxChunkLength == 0U) { return False; }
+    }
+}
+
+/**
+ * @brief Get the time left until the given OS tick count.
+ * @param Deadline OS tick count.
+ * @return Time in milliseconds, 0 once the deadline has passed.
+ */
+static U32 Protocol_msUntil(U32 Deadline)
+{
+    const S32 Remaining = (S32)(Deadline - Osal_GetTickCount());
+    return (Remaining > 0) ? Osal_msFromTicks((U32)Remaining) : 0U;
 }
 
 /**
- * @brief Transmit a response message.
+ * @brief Get the time left until the next deadline, the confirmation of a baud rate
+ *        switch or the next telemetry sample.
+ * @return Time in milliseconds, OSAL_WAIT_FOREVER without deadline.
  */
-static void Protocol_TransmitMessage(const Protocol_MessageType* Message)
+static U32 Protocol_GetDeadlineTimeout(void)
 {
-    Uart_Transmit(UartHandle, (U8*)Message, MSG_SIZE);
+    U32 Timeout_ms = (BaudSwitchState == PROTOCOL_BAUD_CONFIRM) ? Protocol_msUntil(ConfirmDeadline) : OSAL_WAIT_FOREVER;
+    if (Subscription.NofSignals > 0U)
+    {
+        const U32 SampleTimeout_ms = Protocol_msUntil(Subscription.NextSample);
+        if (SampleTimeout_ms < Timeout_ms) { Timeout_ms = SampleTimeout_ms; }
+    }
+    return Timeout_ms;
+}
+
+/**
+ * @brief Discard recieved data, including a partially recieved frame & queued requests.
+ */
+static void Protocol_RxClear(void)
+{
+    Uart_RxBufferClear(UartHandle);
+    RxChunkLength = 0U;
+    RxChunkIndex = 0U;
+    RxFrameLength = 0U;
+    RxFrameOverflow = False;
+    RxQueue.Count = 0U;
+}
+
+/**
+ * @brief Switch to the given baud rate once the queued data has been transmitted.
+ * @param BaudRate Baud rate to switch to.
+ * @param State Switch state until the switch is complete, see Protocol_AwaitBaudRateSwitch().
+ */
+static void Protocol_SwitchBaudRate(U32 BaudRate, Protocol_BaudSwitchEnum State)
+{
+    if (Uart_SetBaudRate(UartHandle, BaudRate, NULL) == RC_OK)
+    {
+        CurrentBaudRate = BaudRate;
+    }
+    BaudSwitchState = State;
+}
+
+/**
+ * @brief Block until a pending baud rate switch is complete, then discard anything
+ *        recieved during the switch.
+ * @param Timeout_ms Time to wait for the switch.
+ * @return True = no switch pending, False = timeout.
+ */
+static Bool Protocol_AwaitBaudRateSwitch(U32 Timeout_ms)
+{
+    const Bool Reverting = (BaudSwitchState == PROTOCOL_BAUD_REVERTING);
+    if ( !Reverting && (BaudSwitchState != PROTOCOL_BAUD_SWITCHING) ) { return True; }
+    if (!Uart_AwaitBaudRateSwitch(UartHandle, Timeout_ms)) { return False; }
+
+    Protocol_RxClear();
+    BaudSwitchState = Reverting ? PROTOCOL_BAUD_IDLE : PROTOCOL_BAUD_CONFIRM;
+    if (!Reverting) { ConfirmDeadline = Osal_GetTickCount() + Osal_msToTicks(PROTOCOL_BAUD_CONFIRM_TIMEOUT_MS); }
+    return True;
+}
+
+/**
+ * @brief Encode a response message into the frame buffer.
+ * @param Message Pointer to message structure.
+ */
+static void Protocol_EncodeMessage(const Protocol_MessageType* Message)
+{
+    /* Header & payload are contiguous, the CRC follows the valid payload bytes */
+    U8 Raw[MSG_SIZE];
+    const U16 PayloadEnd = MSG_HEADER_SIZE + Message->Length;
+    memcpy(Raw, Message, PayloadEnd);
+    Raw[PayloadEnd] = Message->Crc;
+
+    const CobsCodec_ResultType Result = CobsCodec_Encode(Raw, PayloadEnd + MSG_CRC_SIZE, TxFrame, sizeof(TxFrame));
+    TxFrameLength = Result.Valid ? Result.Length : 0U;
+}
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+/**
+ * @brief Add a measured latency to the histogram of the given stage.
+ * @param Stage Request handling stage.
+ * @param Start Cycle counter value at the start of the stage.
+ * @param Stop Cycle counter value at the end of the stage.
+ */
+static void Protocol_RecordLatency(Protocol_LatencyStageEnum Stage, U32 Start, U32 Stop)
+{
+    /* Data recieved past the end of a request is stamped after its handling started. */
+    const U32 Cycles = ((S32)(Stop - Start) > 0) ? (Stop - Start) : 0U;
+    const U32 Latency_us = Cycles / CyclesPerUs;
+    U8 Bin = (Latency_us == 0U) ? 0U : (U8)(31U - __CLZ(Latency_us));
+    if (Bin >= PROTOCOL_LATENCY_NOF_BINS) { Bin = PROTOCOL_LATENCY_NOF_BINS - 1U; }
+
+    LatencyHistograms[Stage].Counts[Bin]++;
+    if (Latency_us > LatencyHistograms[Stage].Max_us) { LatencyHistograms[Stage].Max_us = Latency_us; }
+}
+
+/**
+ * @brief Record the stages ending with transmission complete of the last response,
+ *        if it has completed.
+ */
+static void Protocol_CollectTxLatency(void)
+{
+    U32 TxComplete;
+    if (TxLatencyPending && Uart_GetTxCompleteTimestamp(UartHandle, &TxComplete))
+    {
+        Protocol_RecordLatency(PROTOCOL_LATENCY_HANDLER_TO_TX, PendingHandlerEnd, TxComplete);
+        Protocol_RecordLatency(PROTOCOL_LATENCY_TOTAL, PendingRxTimestamp, TxComplete);
+        TxLatencyPending = False;
+    }
+}
+#endif /* UART_TIMESTAMP_ENABLE */
+
+/**
+ * @brief Recieve stage, queue recieved requests until the queue is full.
+ * @param Timeout_ms Time to wait for the first request, OSAL_WAIT_FOREVER to wait indefinitely.
+ * @return True = at least one request was queued, False = timeout.
+ */
+static Bool Protocol_RecieveStage(U32 Timeout_ms)
+{
+    Bool Recieved = False;
+    while (RxQueue.Count < PROTOCOL_RX_QUEUE_LENGTH)
+    {
+        Protocol_RequestType* const Request =
+            &Requests[(RxQueue.Head + RxQueue.Count) & (PROTOCOL_RX_QUEUE_LENGTH - 1U)];
+        if (!Protocol_RecieveMessage(&Request->Message, Recieved ? 0U : Timeout_ms)) { break; }
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+        /* Last byte recieved so far, the end of the request when the link pauses after it */
+        Request->RxTimestamp = Uart_GetRxTimestamp(UartHandle);
+#endif /* UART_TIMESTAMP_ENABLE */
+        RxQueue.Count++;
+        Recieved = True;
+    }
+    return Recieved;
+}
+
+/**
+ * @brief Handler stage, handle queued requests while there is room for the responses.
+ *        Paused once a baud rate switch is committed, until its response has been written.
+ */
+static void Protocol_HandlerStage(void)
+{
+    while ( (RxQueue.Count > 0U) && (TxQueue.Count < PROTOCOL_TX_QUEUE_LENGTH) &&
+            (BaudSwitchState != PROTOCOL_BAUD_COMMITTED) )
+    {
+        const Protocol_RequestType* const Request = &Requests[RxQueue.Head];
+        Protocol_ResponseType* const Response =
+            &Responses[(TxQueue.Head + TxQueue.Count) & (PROTOCOL_TX_QUEUE_LENGTH - 1U)];
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+        const U32 HandlerStart = ReadCycleCounter();
+        MsgHandler_HandleMessage(&Request->Message, &Response->Message);
+        const U32 HandlerEnd = ReadCycleCounter();
+        Protocol_RecordLatency(PROTOCOL_LATENCY_RX_TO_HANDLER, Request->RxTimestamp, HandlerStart);
+        Protocol_RecordLatency(PROTOCOL_LATENCY_HANDLER, HandlerStart, HandlerEnd);
+        Response->RxTimestamp = Request->RxTimestamp;
+        Response->HandlerEnd = HandlerEnd;
+#else
+        MsgHandler_HandleMessage(&Request->Message, &Response->Message);
+#endif /* UART_TIMESTAMP_ENABLE */
+        Response->SwitchBaudRate = (BaudSwitchState == PROTOCOL_BAUD_COMMITTED);
+        Response->Telemetry = False;
+
+        RxQueue.Head = (RxQueue.Head + 1U) & (PROTOCOL_RX_QUEUE_LENGTH - 1U);
+        RxQueue.Count--;
+        TxQueue.Count++;
+    }
+}
+
+/**
+ * @brief Telemetry stage, queue a telemetry message once the sample is due. Samples
+ *        are taken on a fixed grid, a sample finding the response queue full is skipped.
+ */
+static void Protocol_TelemetryStage(void)
+{
+    if ( (Subscription.NofSignals == 0U) || (Protocol_msUntil(Subscription.NextSample) > 0U) ) { return; }
+
+    if (TxQueue.Count < PROTOCOL_TX_QUEUE_LENGTH)
+    {
+        Protocol_ResponseType* const Response =
+            &Responses[(TxQueue.Head + TxQueue.Count) & (PROTOCOL_TX_QUEUE_LENGTH - 1U)];
+        MsgHandler_ConstructTelemetry(Subscription.SignalIds, Subscription.NofSignals, &Response->Message);
+        Response->SwitchBaudRate = False;
+        Response->Telemetry = True;
+        TxQueue.Count++;
+    }
+
+    /* Resynchronize rather than catch up after falling behind by more than a period */
+    Subscription.NextSample += Subscription.Period;
+    if (Protocol_msUntil(Subscription.NextSample) == 0U)
+    {
+        Subscription.NextSample = Osal_GetTickCount() + Subscription.Period;
+    }
+}
+
+/**
+ * @brief Transmit stage, write queued responses to the UART output buffer while they
+ *        fit. Switches baud rate once a commit response is written.
+ * @param Timeout_ms Time to wait for room for the first response, 0 to not block.
+ */
+static void Protocol_TransmitStage(U32 Timeout_ms)
+{
+    while (TxQueue.Count > 0U)
+    {
+        const Protocol_ResponseType* const Response = &Responses[TxQueue.Head];
+        if (TxFrameLength == 0U) { Protocol_EncodeMessage(&Response->Message); }
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+        /* Only the last response of a burst is measured, the line stays busy in between */
+        Protocol_CollectTxLatency();
+        U32 Stale;
+        (void)Uart_GetTxCompleteTimestamp(UartHandle, &Stale);
+#endif /* UART_TIMESTAMP_ENABLE */
+        if (TxFrameLength > 0U)
+        {
+            const Bool Written = (Timeout_ms > 0U) ? Uart_WriteTimeout(UartHandle, TxFrame, TxFrameLength, Timeout_ms) :
+                                                     Uart_Transmit(UartHandle, TxFrame, TxFrameLength);
+            if (!Written) { return; }
+            Timeout_ms = 0U;
+        }
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+        PendingRxTimestamp = Response->RxTimestamp;
+        PendingHandlerEnd = Response->HandlerEnd;
+        TxLatencyPending = !Response->Telemetry;
+#endif /* UART_TIMESTAMP_ENABLE */
+
+        TxFrameLength = 0U;
+        TxQueue.Head = (TxQueue.Head + 1U) & (PROTOCOL_TX_QUEUE_LENGTH - 1U);
+        TxQueue.Count--;
+
+        if (Response->SwitchBaudRate)
+        {
+            /* Nothing more goes out until the switch is complete */
+            PreviousBaudRate = CurrentBaudRate;
+            Protocol_SwitchBaudRate(ProposedBaudRate, PROTOCOL_BAUD_SWITCHING);
+            return;
+        }
+    }
 }
 
 /* -------------------------- Public function definitions -------------------------- */
@@ -52,25 +474,157 @@ void Protocol_Init(USART_TypeDef* Uart, U32 BaudRate, Pin_PortPinEnum TxPin, Pin
             .WordLength = UART_WORD_LEN_8,
             .StopBits = UART_STOP_BITS_1,
             .RxPin = RxPin,
-            .TxPin = TxPin
+            .TxPin = TxPin,
+            .RxMode = UART_TRANSFER_MODE_DMA,
+            .TxMode = UART_TRANSFER_MODE_DMA,
+            .TxBuffer = UartTxBuffer,
+            .TxBufferSize = PROTOCOL_UART_BUFFER_SIZE,
+            .RxBuffer = UartRxBuffer,
+            .RxBufferSize = PROTOCOL_UART_BUFFER_SIZE
         };
         UartHandle = Uart_Init(Uart, &UartCfg);
+        CurrentBaudRate = BaudRate;
         Uart_TxEnable(UartHandle);
         Uart_RxEnable(UartHandle);
+        /* Wake the reader at each frame delimiter, configurable while disabled only */
+        Uart_CharacterMatchInterruptEnable(UartHandle, MSG_FRAME_DELIMITER);
         Uart_Enable(UartHandle);
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+        EnableCycleCounter();
+        const U32 HclkFreq_MHz = ClkCtrl_GetNodeFreq(CLK_NODE_HCLK) / 1000000UL;
+        CyclesPerUs = (HclkFreq_MHz != 0U) ? HclkFreq_MHz : 1U;
+#endif /* UART_TIMESTAMP_ENABLE */
         ProtocolInitialized = True;
     }
 }
 
 void Protocol_Run(void)
 {
-    static Bool MsgHandlerBusy = False;
-    if ( Uart_GetNofInputBufferBytes(UartHandle) >= MSG_SIZE && !MsgHandlerBusy )
+    if (!Protocol_AwaitBaudRateSwitch(PROTOCOL_BAUD_CONFIRM_TIMEOUT_MS)) { return; }
+
+    const Bool AwaitConfirm = (BaudSwitchState == PROTOCOL_BAUD_CONFIRM);
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    Protocol_CollectTxLatency();
+#endif /* UART_TIMESTAMP_ENABLE */
+
+    /* Responses left queued are stalled by a full output buffer, block until there is room.
+       Requests keep arriving in the UART input buffer meanwhile. */
+    if (TxQueue.Count > 0U) { Protocol_TransmitStage(Protocol_GetDeadlineTimeout()); }
+
+    /* Block for requests until the next deadline, unless there is work left to do */
+    const Bool CanHandle = (RxQueue.Count > 0U) && (TxQueue.Count < PROTOCOL_TX_QUEUE_LENGTH) &&
+                           (BaudSwitchState != PROTOCOL_BAUD_COMMITTED);
+    const U32 Timeout_ms = ( CanHandle || (TxQueue.Count > 0U) ) ? 0U : Protocol_GetDeadlineTimeout();
+
+    if (Protocol_RecieveStage(Timeout_ms))
+    {
+        /* Any message recieved at the new baud rate confirms the switch. */
+        if (AwaitConfirm) { BaudSwitchState = PROTOCOL_BAUD_IDLE; }
+    }
+    else if ( AwaitConfirm && (Protocol_msUntil(ConfirmDeadline) == 0U) )
+    {
+        /* The link is lost, so are its subscription & pending responses */
+        Subscription.NofSignals = 0U;
+        TxQueue.Count = 0U;
+        TxFrameLength = 0U;
+        Protocol_SwitchBaudRate(PreviousBaudRate, PROTOCOL_BAUD_REVERTING);
+        return;
+    }
+
+    Protocol_HandlerStage();
+    Protocol_TelemetryStage();
+    Protocol_TransmitStage(0U);
+}
+
+ReturnCodeEnum Protocol_ProposeBaudRate(U32 BaudRate, S32* BaudError_ppm)
+{
+    S32 Error_ppm = 0;
+    const Bool Attainable = (Uart_CheckBaudRate(UartHandle, BaudRate, &Error_ppm) == RC_OK);
+    *BaudError_ppm = Error_ppm;
+    if ( !Attainable || (Error_ppm > PROTOCOL_MAX_BAUD_ERROR_PPM) || (Error_ppm < -PROTOCOL_MAX_BAUD_ERROR_PPM) )
     {
-        MsgHandlerBusy = True;
-        Protocol_RecieveMessage(&RxMsg);
-        MsgHandler_HandleMessage(&RxMsg, &TxMsg);
-        Protocol_TransmitMessage(&TxMsg);
-        MsgHandlerBusy = False;
+        BaudSwitchState = PROTOCOL_BAUD_IDLE;
+        return RC_ERROR;
     }
+    ProposedBaudRate = BaudRate;
+    BaudSwitchState = PROTOCOL_BAUD_PROPOSED;
+    return RC_OK;
+}
+
+ReturnCodeEnum Protocol_CommitBaudRate(U32 BaudRate)
+{
+    if ( (BaudSwitchState != PROTOCOL_BAUD_PROPOSED) || (BaudRate != ProposedBaudRate) ) { return RC_ERROR; }
+    BaudSwitchState = PROTOCOL_BAUD_COMMITTED;
+    return RC_OK;
+}
+
+ReturnCodeEnum Protocol_Subscribe(U32 Period_ms, const U8* SignalIds, U8 NofSignals)
+{
+    if ( (Period_ms == 0U) || (NofSignals == 0U) )
+    {
+        Subscription.NofSignals = 0U;
+        return RC_OK;
+    }
+    if ( (NofSignals > PROTOCOL_MAX_NOF_SIGNALS) || (Period_ms < PROTOCOL_MIN_TELEMETRY_PERIOD_MS) ) { return RC_ERROR; }
+
+    memcpy(Subscription.SignalIds, SignalIds, NofSignals);
+    Subscription.NofSignals = NofSignals;
+    Subscription.Period = Osal_msToTicks(Period_ms);
+    Subscription.NextSample = Osal_GetTickCount() + Subscription.Period;
+    return RC_OK;
+}
+
+U32 Protocol_GetBaudRate(void)
+{
+    return CurrentBaudRate;
 }
+
+Uart_HandleType Protocol_GetUartHandle(void)
+{
+    return UartHandle;
+}
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+U32 Protocol_GetLatencyCount(Protocol_LatencyStageEnum Stage, U8 Bin)
+{
+    if ( (Stage >= PROTOCOL_LATENCY_ENUM_LIMIT) || (Bin >= PROTOCOL_LATENCY_NOF_BINS) ) { return 0U; }
+    return LatencyHistograms[Stage].Counts[Bin];
+}
+
+U32 Protocol_GetLatencyMax_us(Protocol_LatencyStageEnum Stage)
+{
+    if (Stage >= PROTOCOL_LATENCY_ENUM_LIMIT) { return 0U; }
+    return LatencyHistograms[Stage].Max_us;
+}
+
+void Protocol_ClearLatencyHistogram(void)
+{
+    for (U8 i = 0; i < PROTOCOL_LATENCY_ENUM_LIMIT; i++)
+    {
+        for (U8 j = 0; j < PROTOCOL_LATENCY_NOF_BINS; j++)
+        {
+            LatencyHistograms[i].Counts[j] = 0U;
+        }
+        LatencyHistograms[i].Max_us = 0U;
+    }
+}
+#endif /* UART_TIMESTAMP_ENABLE */
+
+/* ----------------- Unit test specific public function definitions. --------------- */
+
+#ifdef UNIT_TEST
+    const U8* Protocol_EncodeResponse(const Protocol_MessageType* Message, U16* FrameLength)
+    {
+        Protocol_EncodeMessage(Message);
+        *FrameLength = TxFrameLength;
+        return TxFrame;
+    }
+
+    Bool Protocol_DecodeRequest(const U8* Frame, U16 FrameLength, Protocol_MessageType* Message)
+    {
+        if (FrameLength > sizeof(RxFrame)) { return False; }
+        memcpy(RxFrame, Frame, FrameLength);
+        return Protocol_DecodeFrame(Message, FrameLength);
+    }
+#endif /* UNIT_TEST */
@@ -13,6 +13,47 @@
 #include "uart.h"
 #include "pin.h"
 
+/*  --------------------------- Preprocessor definitions --------------------------- */
+
+/**
+ * @brief Number of latency histogram bins. Bin N counts latencies of [2^N, 2^(N+1)) us,
+ *        the first bin includes latencies below 1 us & the last one all longer latencies.
+ */
+#define PROTOCOL_LATENCY_NOF_BINS   (16U)
+
+/**
+ * @brief Number of recieved requests awaiting handling & of responses awaiting
+ *        transmission, powers of two. Bounds the number of requests in flight.
+ */
+#define PROTOCOL_RX_QUEUE_LENGTH    (4U)
+#define PROTOCOL_TX_QUEUE_LENGTH    (4U)
+
+/**
+ * @brief Size of the UART input & output buffers, a power of two holding several frames.
+ */
+#define PROTOCOL_UART_BUFFER_SIZE   (512U)
+
+/**
+ * @brief Maximum number of signals streamed by a telemetry subscription & shortest
+ *        telemetry period.
+ */
+#define PROTOCOL_MAX_NOF_SIGNALS            (16U)
+#define PROTOCOL_MIN_TELEMETRY_PERIOD_MS    (10U)
+
+/*  -------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Enumeration of the measured stages of request handling.
+ */
+typedef enum
+{
+    PROTOCOL_LATENCY_RX_TO_HANDLER = 0x0U,  /* Last byte of the request recieved until handling starts */
+    PROTOCOL_LATENCY_HANDLER = 0x1U,        /* Handling of the request */
+    PROTOCOL_LATENCY_HANDLER_TO_TX = 0x2U,  /* Handling done until the last byte of the response is sent */
+    PROTOCOL_LATENCY_TOTAL = 0x3U,          /* Last byte of the request until last byte of the response */
+    PROTOCOL_LATENCY_ENUM_LIMIT
+} Protocol_LatencyStageEnum;
+
 /* -------------------------- Public function prototypes --------------------------- */
 
 /**
@@ -23,9 +64,109 @@
 void Protocol_Init(USART_TypeDef* Uart, U32 BaudRate, Pin_PortPinEnum TxPin, Pin_PortPinEnum RxPin);
 
 /**
- * @brief Execute the protocol handler.
- * @note Should be called periodically.
+ * @brief Execute the protocol handler, a pipeline of three stages:
+ *        1. Recieve: all complete frames recieved are queued as requests.
+ *        2. Handle: queued requests are handled while there is room for the responses.
+ *        3. Transmit: queued responses are written to the UART while they fit.
+ *        Blocks the calling thread until a message is recieved when idle, so that the
+ *        host may send further requests before the responses to the previous ones.
+ *        While responses are stalled by a full output buffer it blocks until there is
+ *        room for them instead.
+ * @note Should be called repeatedly from the communication thread.
  */
 void Protocol_Run(void);
 
+/**
+ * @brief Validate a baud rate proposed by the host, first step of a baud rate switch.
+ *        The switch sequence is:
+ *        1. Host proposes a baud rate, the device accepts if attainable within tolerance.
+ *        2. Host commits the proposed baud rate. The device switches once its response
+ *           is transmitted, the host once the response is recieved.
+ *        3. Host sends any message at the new baud rate. Should none be recieved in
+ *           time the device reverts to the previous baud rate.
+ *        The host side is implemented by ProtocolClient.switch_baudrate() in scripts/protocol.py.
+ * @param BaudRate Proposed baud rate.
+ * @param BaudError_ppm Deviation of the attainable from the proposed baud rate in parts per million.
+ * @return RC_OK = accepted, RC_ERROR = rejected.
+ */
+ReturnCodeEnum Protocol_ProposeBaudRate(U32 BaudRate, S32* BaudError_ppm);
+
+/**
+ * @brief Commit the previously proposed baud rate, the switch takes place after
+ *        transmission of the response to the current message. Requests queued behind
+ *        it are discarded, the host must await the response before switching.
+ * @param BaudRate Baud rate to commit, must match the proposed one.
+ * @return RC_OK = committed, RC_ERROR = no matching proposal.
+ */
+ReturnCodeEnum Protocol_CommitBaudRate(U32 BaudRate);
+
+/**
+ * @brief Get the current baud rate of the protocol UART.
+ * @return Baud rate.
+ */
+U32 Protocol_GetBaudRate(void);
+
+/**
+ * @brief Subscribe the link to telemetry, replacing any previous subscription. The values
+ *        of the given signals are streamed unsolicited, packed into a single TELEMETRY_RESPONSE
+ *        frame per period, starting one period after the response to the current message.
+ *        The subscription is cancelled when the link is lost after a baud rate switch.
+ * @param Period_ms Telemetry period, 0 cancels the subscription.
+ * @param SignalIds Signals to stream, validated by the caller.
+ * @param NofSignals Number of signals, 0 cancels the subscription.
+ * @return RC_OK = subscribed or cancelled, RC_ERROR = too many signals or too short period.
+ */
+ReturnCodeEnum Protocol_Subscribe(U32 Period_ms, const U8* SignalIds, U8 NofSignals);
+
+/**
+ * @brief Get the handle of the UART peripheral used by the protocol handler.
+ * @return UART peripheral handle, NULL before initialization.
+ */
+Uart_HandleType Protocol_GetUartHandle(void);
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+/**
+ * @brief Get the number of requests whose latency in the given stage fell into the given bin.
+ * @param Stage Request handling stage.
+ * @param Bin Histogram bin, see PROTOCOL_LATENCY_NOF_BINS.
+ * @return Number of requests, 0 for an invalid stage or bin.
+ */
+U32 Protocol_GetLatencyCount(Protocol_LatencyStageEnum Stage, U8 Bin);
+
+/**
+ * @brief Get the longest latency measured in the given stage.
+ * @param Stage Request handling stage.
+ * @return Latency in microseconds, 0 for an invalid stage.
+ */
+U32 Protocol_GetLatencyMax_us(Protocol_LatencyStageEnum Stage);
+
+/**
+ * @brief Reset the latency histograms of all stages.
+ */
+void Protocol_ClearLatencyHistogram(void);
+#endif /* UART_TIMESTAMP_ENABLE */
+
+/* ----------------- Unit test specific public function definitions. --------------- */
+
+#ifdef UNIT_TEST
+    #include "protocol_cfg.h"
+
+    /**
+     * @brief Encode the given response message into the frame buffer used for transmission.
+     * @param Message Pointer to message structure.
+     * @param FrameLength Length of the encoded frame, delimiter included. 0 if encoding failed.
+     * @return Pointer to the frame buffer.
+     */
+    const U8* Protocol_EncodeResponse(const Protocol_MessageType* Message, U16* FrameLength);
+
+    /**
+     * @brief Decode the given frame as a recieved request.
+     * @param Frame Pointer to the frame.
+     * @param FrameLength Length of the frame, delimiter included.
+     * @param Message Pointer to message structure.
+     * @return True = valid message, False = corrupted frame.
+     */
+    Bool Protocol_DecodeRequest(const U8* Frame, U16 FrameLength, Protocol_MessageType* Message);
+#endif /* UNIT_TEST */
+
 #endif /* PROTOCOL_H */
\ No newline at end of file
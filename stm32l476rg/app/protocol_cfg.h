@@ -13,10 +13,29 @@
 #include "cmsis_compiler.h"
 
 /*  --------------------------- Preprocessor definitions --------------------------- */
+
+/**
+ * @brief Messages are transferred as [id][len][payload][crc], len being the number of
+ *        payload bytes. Each message is COBS encoded into a frame ending with a zero
+ *        delimiter, the receiver resynchronizes on the next delimiter after any error.
+ *        The CRC-8 covers the id, len & payload bytes.
+ */
 #define MSG_ID_SIZE         (1U)
-#define MSG_PAYLOAD_SIZE    (8U)
+#define MSG_LEN_SIZE        (1U)
+#define MSG_PAYLOAD_SIZE    (128U)      /* Maximum payload size, at most 253 bytes. */
 #define MSG_CRC_SIZE        (1U)
-#define MSG_SIZE            (MSG_ID_SIZE + MSG_PAYLOAD_SIZE + MSG_CRC_SIZE)
+#define MSG_HEADER_SIZE     (MSG_ID_SIZE + MSG_LEN_SIZE)
+#define MSG_SIZE            (MSG_HEADER_SIZE + MSG_PAYLOAD_SIZE + MSG_CRC_SIZE)
+
+/**
+ * @brief Worst case size of an encoded message, including the delimiter.
+ */
+#define MSG_FRAME_SIZE      (MSG_SIZE + (MSG_SIZE / 254U) + 2U)
+
+/**
+ * @brief Frame delimiter, never part of an encoded message.
+ */
+#define MSG_FRAME_DELIMITER (0x00U)
 
 /**
  * @brief Response IDs.
@@ -25,6 +44,7 @@
 #define NACK_RESPONSE       (0x01U)
 #define CRC_ERROR_RESPONSE  (0x02U)
 #define INVALID_ID_RESPONSE (0x04U)
+#define TELEMETRY_RESPONSE  (0x08U)     /* Unsolicited, see MsgHandler_ConstructTelemetry(). */
 
 /*  ----------------- Structures, enumerations & type definitions ------------------ */
 
@@ -34,9 +54,11 @@
 typedef __PACKED_STRUCT
 {
     U8 Id;
-    U8 Payload[MSG_PAYLOAD_SIZE];
+    U8 Length;                      /* Number of valid payload bytes. */
+    U8 Payload[MSG_PAYLOAD_SIZE];   /* Recieved payload is zero padded to the maximum size. */
     U8 Crc;
 } Protocol_MessageType;
-StaticAssert(sizeof(Protocol_MessageType) == 10U, "Unwanted padding Protocol_MessageType");
+StaticAssert(sizeof(Protocol_MessageType) == MSG_SIZE, "Unwanted padding Protocol_MessageType");
+StaticAssert((MSG_HEADER_SIZE + MSG_PAYLOAD_SIZE) <= 255U, "CRC-8 input length exceeds U8");
 
 #endif /* PROTOCOL_CFG_H */
@@ -12,7 +12,7 @@
 
 /* -------------------------- Public function definitions -------------------------- */
 
-void Fifo_Init(FifoType* Fifo, U8* Buffer, const U8 Length)
+void Fifo_Init(FifoType* Fifo, U8* Buffer, const U16 Length)
 {
     Fifo->Buffer = Buffer;
     Fifo->Length = Length;
@@ -23,7 +23,7 @@ void Fifo_Init(FifoType* Fifo, U8* Buffer, const U8 Length)
 }
 
 
-void Fifo_WriteByte(FifoType* Fifo, U8 Data)
+RAMFUNC void Fifo_WriteByte(FifoType* Fifo, U8 Data)
 {
     if (Fifo_Full(Fifo)) return;
     Fifo->Buffer[Fifo->Head] = Data;
@@ -32,7 +32,7 @@ void Fifo_WriteByte(FifoType* Fifo, U8 Data)
 }
 
 
-void Fifo_ReadByte(FifoType* Fifo, U8* Data)
+RAMFUNC void Fifo_ReadByte(FifoType* Fifo, U8* Data)
 {
     if (Fifo_Empty(Fifo)) return;
     *Data = Fifo->Buffer[Fifo->Tail];
@@ -41,35 +41,68 @@ void Fifo_ReadByte(FifoType* Fifo, U8* Data)
 }
 
 
-Bool Fifo_Empty(const FifoType* Fifo)
+RAMFUNC Bool Fifo_Empty(const FifoType* Fifo)
 {
     return Fifo->NofItems == 0;
 }
 
 
-Bool Fifo_Full(const FifoType* Fifo)
+RAMFUNC Bool Fifo_Full(const FifoType* Fifo)
 {
     return Fifo->NofItems == Fifo->Length;
 }
 
 
-U8 Fifo_GetNofAvailable(const FifoType* Fifo)
+RAMFUNC U16 Fifo_GetNofAvailable(const FifoType* Fifo)
 {
     return (Fifo->Length - Fifo->NofItems);
 }
 
 
-U8 Fifo_GetNofItems(const FifoType* Fifo)
+RAMFUNC U16 Fifo_GetNofItems(const FifoType* Fifo)
 {
     return Fifo->NofItems;
 }
 
 
+RAMFUNC U16 Fifo_CommitWrite(FifoType* Fifo, U16 Count)
+{
+    U16 Dropped = 0;
+    Fifo->Head = (Fifo->Head + Count) & Fifo->Mask;
+    if (Count > Fifo_GetNofAvailable(Fifo))
+    {
+        Dropped = Count - Fifo_GetNofAvailable(Fifo);
+        Fifo->NofItems = Fifo->Length;
+        Fifo->Tail = Fifo->Head;
+    }
+    else
+    {
+        Fifo->NofItems += Count;
+    }
+    return Dropped;
+}
+
+
+RAMFUNC U16 Fifo_GetNofContiguousItems(const FifoType* Fifo)
+{
+    const U16 UntilWrap = Fifo->Length - Fifo->Tail;
+    return (Fifo->NofItems < UntilWrap) ? Fifo->NofItems : UntilWrap;
+}
+
+
+RAMFUNC void Fifo_CommitRead(FifoType* Fifo, U16 Count)
+{
+    if (Count > Fifo->NofItems) { Count = Fifo->NofItems; }
+    Fifo->Tail = (Fifo->Tail + Count) & Fifo->Mask;
+    Fifo->NofItems -= Count;
+}
+
+
 void Fifo_Clear(FifoType* Fifo, Bool ZeroFill)
 {
     if (ZeroFill)
     {
-        for (U8 i = 0; i < Fifo->Length; i++)
+        for (U16 i = 0; i < Fifo->Length; i++)
         {
             Fifo->Buffer[i] = 0;
         }
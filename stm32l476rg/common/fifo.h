@@ -3,7 +3,8 @@
  *
  * @brief First In First Out buffer data structure.
  * @note Wrap-around logic requires the size of the underlying buffer
- *       to be a power of two.
+ *       to be a power of two. Functions used from interrupt handlers
+ *       execute from RAM.
  */
 
 #ifndef FIFO_H
@@ -20,11 +21,11 @@
 typedef struct FifoType
 {
     U8* Buffer;
-    U8 Length;
-    U8 Mask;
-    U8 Head;
-    U8 Tail;
-    U8 NofItems;
+    U16 Length;
+    U16 Mask;
+    U16 Head;
+    U16 Tail;
+    U16 NofItems;
 } FifoType;
 
 /* --------------------------- Public function prototypes -------------------------- */
@@ -33,9 +34,9 @@ typedef struct FifoType
  * @brief Initialization function for fifo structures.
  * @param Fifo Pointer to fifo structure.
  * @param Buffer Pointer to buffer where data for the fifo to manage is stored.
- * @param Length Length of buffer.
+ * @param Length Length of buffer, a power of two up to 32768.
  */
-void Fifo_Init(FifoType* Fifo, U8* Buffer, const U8 Length);
+void Fifo_Init(FifoType* Fifo, U8* Buffer, const U16 Length);
 
 
 /**
@@ -43,7 +44,7 @@ void Fifo_Init(FifoType* Fifo, U8* Buffer, const U8 Length);
  * @param Fifo Pointer to fifo structure.
  * @param Data Byte to be written.
  */
-void Fifo_WriteByte(FifoType* Fifo, U8 Data);
+RAMFUNC void Fifo_WriteByte(FifoType* Fifo, U8 Data);
 
 
 /**
@@ -51,7 +52,7 @@ void Fifo_WriteByte(FifoType* Fifo, U8 Data);
  * @param Fifo Pointer to fifo structure.
  * @param Data Pointer to where the read data should be stored.
  */
-void Fifo_ReadByte(FifoType* Fifo, U8* Data);
+RAMFUNC void Fifo_ReadByte(FifoType* Fifo, U8* Data);
 
 
 /**
@@ -59,7 +60,7 @@ void Fifo_ReadByte(FifoType* Fifo, U8* Data);
  * @param Fifo Pointer to fifo structure.
  * @returns True = empty, False = not empty
  */
-Bool Fifo_Empty(const FifoType* Fifo);
+RAMFUNC Bool Fifo_Empty(const FifoType* Fifo);
 
 
 /**
@@ -67,7 +68,7 @@ Bool Fifo_Empty(const FifoType* Fifo);
  * @param Fifo Pointer to fifo structure.
  * @returns True = full, False = not full
  */
-Bool Fifo_Full(const FifoType* Fifo);
+RAMFUNC Bool Fifo_Full(const FifoType* Fifo);
 
 
 /**
@@ -76,7 +77,7 @@ Bool Fifo_Full(const FifoType* Fifo);
  * @param Fifo Pointer to fifo structure.
  * @returns Number of available bytes that can be written.
  */
-U8 Fifo_GetNofAvailable(const FifoType* Fifo);
+RAMFUNC U16 Fifo_GetNofAvailable(const FifoType* Fifo);
 
 
 /**
@@ -85,7 +86,36 @@ U8 Fifo_GetNofAvailable(const FifoType* Fifo);
  * @param Fifo Pointer to fifo strcture.
  * @returns Number of unread bytes.
  */
-U8 Fifo_GetNofItems(const FifoType* Fifo);
+RAMFUNC U16 Fifo_GetNofItems(const FifoType* Fifo);
+
+
+/**
+ * @brief Publish bytes that have been written directly into the underlying
+ *        buffer at the head position, e.g. by DMA, by advancing the head.
+ *        Should the fifo overflow the oldest unread bytes are discarded.
+ * @param Fifo Pointer to fifo structure.
+ * @param Count Number of bytes written past the head.
+ * @returns Number of unread bytes that were overwritten.
+ */
+RAMFUNC U16 Fifo_CommitWrite(FifoType* Fifo, U16 Count);
+
+
+/**
+ * @brief Checks a fifo structure for the number of unread bytes stored
+ *        contiguously from the tail, i.e. before the buffer wraps around.
+ * @param Fifo Pointer to fifo structure.
+ * @returns Number of unread bytes readable in one span.
+ */
+RAMFUNC U16 Fifo_GetNofContiguousItems(const FifoType* Fifo);
+
+
+/**
+ * @brief Release bytes that have been read directly from the underlying
+ *        buffer at the tail position, e.g. by DMA, by advancing the tail.
+ * @param Fifo Pointer to fifo structure.
+ * @param Count Number of bytes read past the tail, at most the number of unread bytes.
+ */
+RAMFUNC void Fifo_CommitRead(FifoType* Fifo, U16 Count);
 
 
 /**
@@ -1,34 +1,303 @@
 /**
  * @file memory_routines.c
  *
- * @brief Provide implementations of memcpy & memset for FreeRTOS to avoid
- *        dependency on libc header string.h.
+ * @brief Provide implementations of memcpy, memset, memmove & memcmp for FreeRTOS
+ *        to avoid dependency on libc header string.h.
  *        Additionally provide helper functions for memory alignment.
+ *
+ * @note The bulk of each routine operates on word aligned 32-bit accesses unrolled
+ *       in blocks of four words, which GCC maps onto LDM/STM instructions on the
+ *       Cortex-M4. Misaligned heads & tails are handled bytewise.
  */
 
 /* ------------------------------- Include directives ------------------------------ */
 #include "memory_routines.h"
 
+/* ------------------------ Private preprocessor definitions ----------------------- */
+
+#define WORD_SIZE           (sizeof(U32))
+#define WORD_ALIGN_MASK     ((uintptr_t)(WORD_SIZE - 1U))
+#define BLOCK_SIZE          (4U * WORD_SIZE)
+
+/* --------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Word type allowed to alias any other type, used for aligned accesses.
+ */
+typedef U32 __attribute__((may_alias)) MemWordType;
+
+/**
+ * @brief Word type allowed to alias any other type without alignment requirement.
+ * @note The Cortex-M4 supports unaligned single word loads & stores as long as
+ *       SCB->CCR.UNALIGN_TRP is not set, multi-word accesses (LDM/STM) must be aligned.
+ */
+typedef U32 __attribute__((may_alias, aligned(1))) MemUnalignedWordType;
+
+/* -------------------------- Private function declarations ------------------------ */
+
+/**
+ * @brief Copy the given number of bytes from lower to higher addresses.
+ *        Safe for overlapping regions as long as Destination < Source.
+ * @param Dst Destination start address.
+ * @param Src Source start address.
+ * @param Count Number of bytes to copy.
+ */
+static inline void MemoryRoutines_CopyForward(U8* Dst, const U8* Src, size_t Count);
+
+/**
+ * @brief Copy the given number of bytes from higher to lower addresses.
+ *        Safe for overlapping regions as long as Destination > Source.
+ * @param Dst Destination start address.
+ * @param Src Source start address.
+ * @param Count Number of bytes to copy.
+ */
+static inline void MemoryRoutines_CopyBackward(U8* Dst, const U8* Src, size_t Count);
+
+/**
+ * @brief Check if the given address is word aligned.
+ * @param Address Address to check.
+ * @return True = word aligned, False = not word aligned.
+ */
+static inline Bool MemoryRoutines_IsWordAligned(const void* Address);
+
+/* -------------------------- Private function definitions ------------------------- */
+
+static inline Bool MemoryRoutines_IsWordAligned(const void* Address)
+{
+    return ( ((uintptr_t)Address & WORD_ALIGN_MASK) == 0U );
+}
+
+NO_LIBCALL_DETECTION
+static inline void MemoryRoutines_CopyForward(U8* Dst, const U8* Src, size_t Count)
+{
+    /* Byte-copy the misaligned head until the destination is word aligned. */
+    while ( (Count > 0U) && !MemoryRoutines_IsWordAligned(Dst) )
+    {
+        *Dst++ = *Src++;
+        Count--;
+    }
+
+    MemWordType* DstWord = (MemWordType*)Dst;
+    if ( MemoryRoutines_IsWordAligned(Src) )
+    {
+        const MemWordType* SrcWord = (const MemWordType*)Src;
+        for (; Count >= BLOCK_SIZE; Count -= BLOCK_SIZE, SrcWord += 4U, DstWord += 4U)
+        {
+            const U32 Word0 = SrcWord[0];
+            const U32 Word1 = SrcWord[1];
+            const U32 Word2 = SrcWord[2];
+            const U32 Word3 = SrcWord[3];
+            DstWord[0] = Word0;
+            DstWord[1] = Word1;
+            DstWord[2] = Word2;
+            DstWord[3] = Word3;
+        }
+
+        for (; Count >= WORD_SIZE; Count -= WORD_SIZE) { *DstWord++ = *SrcWord++; }
+        Src = (const U8*)SrcWord;
+    }
+    else
+    {
+        /* Source & destination are mutually misaligned, fall back to unaligned loads. */
+        const MemUnalignedWordType* SrcWord = (const MemUnalignedWordType*)Src;
+        for (; Count >= BLOCK_SIZE; Count -= BLOCK_SIZE, SrcWord += 4U, DstWord += 4U)
+        {
+            const U32 Word0 = SrcWord[0];
+            const U32 Word1 = SrcWord[1];
+            const U32 Word2 = SrcWord[2];
+            const U32 Word3 = SrcWord[3];
+            DstWord[0] = Word0;
+            DstWord[1] = Word1;
+            DstWord[2] = Word2;
+            DstWord[3] = Word3;
+        }
+
+        for (; Count >= WORD_SIZE; Count -= WORD_SIZE) { *DstWord++ = *SrcWord++; }
+        Src = (const U8*)SrcWord;
+    }
+    Dst = (U8*)DstWord;
+
+    /* Byte-copy the tail. */
+    while (Count > 0U)
+    {
+        *Dst++ = *Src++;
+        Count--;
+    }
+}
+
+NO_LIBCALL_DETECTION
+static inline void MemoryRoutines_CopyBackward(U8* Dst, const U8* Src, size_t Count)
+{
+    Dst += Count;
+    Src += Count;
+
+    /* Byte-copy the misaligned tail until the destination end is word aligned. */
+    while ( (Count > 0U) && !MemoryRoutines_IsWordAligned(Dst) )
+    {
+        *--Dst = *--Src;
+        Count--;
+    }
+
+    MemWordType* DstWord = (MemWordType*)Dst;
+    if ( MemoryRoutines_IsWordAligned(Src) )
+    {
+        const MemWordType* SrcWord = (const MemWordType*)Src;
+        for (; Count >= BLOCK_SIZE; Count -= BLOCK_SIZE)
+        {
+            SrcWord -= 4U;
+            DstWord -= 4U;
+            const U32 Word0 = SrcWord[0];
+            const U32 Word1 = SrcWord[1];
+            const U32 Word2 = SrcWord[2];
+            const U32 Word3 = SrcWord[3];
+            DstWord[0] = Word0;
+            DstWord[1] = Word1;
+            DstWord[2] = Word2;
+            DstWord[3] = Word3;
+        }
+
+        for (; Count >= WORD_SIZE; Count -= WORD_SIZE) { *--DstWord = *--SrcWord; }
+        Src = (const U8*)SrcWord;
+    }
+    else
+    {
+        const MemUnalignedWordType* SrcWord = (const MemUnalignedWordType*)Src;
+        for (; Count >= BLOCK_SIZE; Count -= BLOCK_SIZE)
+        {
+            SrcWord -= 4U;
+            DstWord -= 4U;
+            const U32 Word0 = SrcWord[0];
+            const U32 Word1 = SrcWord[1];
+            const U32 Word2 = SrcWord[2];
+            const U32 Word3 = SrcWord[3];
+            DstWord[0] = Word0;
+            DstWord[1] = Word1;
+            DstWord[2] = Word2;
+            DstWord[3] = Word3;
+        }
+
+        for (; Count >= WORD_SIZE; Count -= WORD_SIZE) { *--DstWord = *--SrcWord; }
+        Src = (const U8*)SrcWord;
+    }
+    Dst = (U8*)DstWord;
+
+    /* Byte-copy the head. */
+    while (Count > 0U)
+    {
+        *--Dst = *--Src;
+        Count--;
+    }
+}
+
 /* -------------------------- Public function definitions -------------------------- */
 
+NO_LIBCALL_DETECTION
 void* memcpy(void* restrict Destination, const void* restrict Source, size_t Count)
 {
-    for (size_t i = 0; i < Count; i++)
+    MemoryRoutines_CopyForward((U8*)Destination, (const U8*)Source, Count);
+    return Destination;
+}
+
+NO_LIBCALL_DETECTION
+void* memset(void* Destination, int Data, size_t Count)
+{
+    U8* Dst = (U8*)Destination;
+    const U8 Fill = (U8)Data;
+
+    /* Byte-fill the misaligned head until the destination is word aligned. */
+    while ( (Count > 0U) && !MemoryRoutines_IsWordAligned(Dst) )
+    {
+        *Dst++ = Fill;
+        Count--;
+    }
+
+    const U32 Pattern = (U32)Fill * 0x01010101UL;
+    MemWordType* DstWord = (MemWordType*)Dst;
+    for (; Count >= BLOCK_SIZE; Count -= BLOCK_SIZE, DstWord += 4U)
+    {
+        DstWord[0] = Pattern;
+        DstWord[1] = Pattern;
+        DstWord[2] = Pattern;
+        DstWord[3] = Pattern;
+    }
+
+    for (; Count >= WORD_SIZE; Count -= WORD_SIZE) { *DstWord++ = Pattern; }
+    Dst = (U8*)DstWord;
+
+    /* Byte-fill the tail. */
+    while (Count > 0U)
     {
-        ((unsigned char*)Destination)[i] = ((unsigned char*)Source)[i];
+        *Dst++ = Fill;
+        Count--;
     }
     return Destination;
 }
 
-void* memset(void* Destination, int Data, size_t Count)
+NO_LIBCALL_DETECTION
+void* memmove(void* Destination, const void* Source, size_t Count)
 {
-    for (size_t i = 0; i < Count; i++)
+    U8* Dst = (U8*)Destination;
+    const U8* Src = (const U8*)Source;
+
+    if ( (Dst != Src) && (Count > 0U) )
     {
-        ((unsigned char*)Destination)[i] = (unsigned char)Data;
+        /* Unsigned wrap-around makes this true both when Dst < Src & when the regions don't overlap. */
+        if ( ((uintptr_t)Dst - (uintptr_t)Src) >= Count )
+        {
+            MemoryRoutines_CopyForward(Dst, Src, Count);
+        }
+        else
+        {
+            MemoryRoutines_CopyBackward(Dst, Src, Count);
+        }
     }
     return Destination;
 }
 
+NO_LIBCALL_DETECTION
+int memcmp(const void* Lhs, const void* Rhs, size_t Count)
+{
+    const U8* LhsByte = (const U8*)Lhs;
+    const U8* RhsByte = (const U8*)Rhs;
+
+    /* Align the left hand side, the right hand side is loaded unaligned if need be. */
+    while ( (Count > 0U) && !MemoryRoutines_IsWordAligned(LhsByte) )
+    {
+        if (*LhsByte != *RhsByte) { return (int)*LhsByte - (int)*RhsByte; }
+        LhsByte++;
+        RhsByte++;
+        Count--;
+    }
+
+    const MemWordType* LhsWord = (const MemWordType*)LhsByte;
+    if ( MemoryRoutines_IsWordAligned(RhsByte) )
+    {
+        const MemWordType* RhsWord = (const MemWordType*)RhsByte;
+        for (; Count >= WORD_SIZE; Count -= WORD_SIZE, LhsWord++, RhsWord++)
+        {
+            /* Let the bytewise loop below locate the first mismatching byte. */
+            if (*LhsWord != *RhsWord) { break; }
+        }
+        RhsByte = (const U8*)RhsWord;
+    }
+    else
+    {
+        const MemUnalignedWordType* RhsWord = (const MemUnalignedWordType*)RhsByte;
+        for (; Count >= WORD_SIZE; Count -= WORD_SIZE, LhsWord++, RhsWord++)
+        {
+            if (*LhsWord != *RhsWord) { break; }
+        }
+        RhsByte = (const U8*)RhsWord;
+    }
+    LhsByte = (const U8*)LhsWord;
+
+    for (; Count > 0U; Count--, LhsByte++, RhsByte++)
+    {
+        if (*LhsByte != *RhsByte) { return (int)*LhsByte - (int)*RhsByte; }
+    }
+    return 0;
+}
+
 Bool IsPowerOfTwo(U32 Value)
 {
     return ( Value > 0 ) && ( ( Value & ( Value - 1U ) ) == 0 );
@@ -36,7 +305,6 @@ Bool IsPowerOfTwo(U32 Value)
 
 Bool IsAligned(void* Address, U32 Alignment)
 {
-    StaticAssert(sizeof(U32) == sizeof(void*), "Mismatched length for type casting from void* to U32");
-    const U32 AlignmentMask = Alignment - 1U;
-    return ( ( (U32)Address & AlignmentMask ) == 0 );
+    const uintptr_t AlignmentMask = (uintptr_t)Alignment - 1U;
+    return ( ( (uintptr_t)Address & AlignmentMask ) == 0 );
 }
@@ -1,8 +1,8 @@
 /**
  * @file memory_routines.h
  *
- * @brief Provide implementations of memcpy & memset for FreeRTOS to avoid
- *        dependency on libc header string.h.
+ * @brief Provide implementations of memcpy, memset, memmove & memcmp for FreeRTOS
+ *        to avoid dependency on libc header string.h.
  *        Additionally provide helper functions for memory alignment.
  */
 
@@ -33,6 +33,26 @@ void* memcpy(void* restrict Destination, const void* restrict Source, size_t Cou
  */
 void* memset(void* Destination, int Data, size_t Count);
 
+/**
+ * @brief Copy the given number of bytes from source to destination,
+ *        the source & destination regions are allowed to overlap.
+ * @param Destination Destination start address.
+ * @param Source Source start address.
+ * @param Count Number of bytes to copy.
+ * @return Copy of Destination.
+ */
+void* memmove(void* Destination, const void* Source, size_t Count);
+
+/**
+ * @brief Compare the given number of bytes of two buffers.
+ * @param Lhs Start address of first buffer.
+ * @param Rhs Start address of second buffer.
+ * @param Count Number of bytes to compare.
+ * @return Zero if equal, otherwise the difference between the first pair
+ *         of mismatching bytes (interpreted as unsigned char).
+ */
+int memcmp(const void* Lhs, const void* Rhs, size_t Count);
+
 /**
  * @brief Check if a value is a power of two (valid memory aligment).
  * @param Value The value to test.
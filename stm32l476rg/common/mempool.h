@@ -65,6 +65,8 @@ void MemPool_Disable(void);
  *         cast into proper pointer type by caller.
  *         Returns NULL if the desired size could not be allocated
  *         in a consecutive memory space. Allocated memory is zero initialized.
+ * @note Relies on the heap section being zero-filled at startup, chunks that have
+ *       never been freed hold indeterminate data if that is disabled at link time.
  */
 void* MemPool_Allocate(U32 Size);
 
@@ -41,8 +41,48 @@ typedef void (*CallbackFunction)(void);
 #if defined(__GNUC__)
     #define ALIGN(Alignment)          __attribute__((aligned((Alignment))))
     #define SECTION(LinkerSection)    __attribute__((section(LinkerSection)))
+
+    /**
+     * @brief Prevent GCC from recognizing copy & fill loops as memcpy/memset idioms
+     *        and replacing them with library calls, for code that implements those
+     *        functions or runs before the C runtime is set up.
+     */
+    #define NO_LIBCALL_DETECTION      __attribute__((optimize("no-tree-loop-distribute-patterns")))
 #endif /* GCC attribute wrapper macros. */
 
+#if !defined(RAMFUNC_ENABLE)
+    #define RAMFUNC_ENABLE (1)
+#endif
+StaticAssert(RAMFUNC_ENABLE == 1 || RAMFUNC_ENABLE == 0, "Missing or invalid value for RAMFUNC_ENABLE!");
+
+/**
+ * @brief Place a function in the .ramfunc section, copied to SRAM2 at startup &
+ *        executed from there with zero wait states instead of depending on ART
+ *        accelerator hits in flash (FLASH_WS_4 at 80 MHz).
+ *        SRAM2 is out of branch range from flash, so calls are made as long calls.
+ *        The macro must therefore be part of the declaration seen by callers.
+ *        Used for the UART interrupt handlers, the FIFO operations, the COBS codec &
+ *        the CRC-8 calculation. The FreeRTOS context switch stays in flash, it is
+ *        part of the unmodified kernel port.
+ *        Cycle counts, ReadCycleCounter() deltas with RAMFUNC_ENABLE=0 & 1 at 80 MHz,
+ *        not yet measured on hardware:
+ *        | Function                                   | Flash | SRAM2 |
+ *        |--------------------------------------------|-------|-------|
+ *        | Usart2_IrqHandler, one byte recieved       |   TBD |   TBD |
+ *        | Fifo_WriteByte                             |   TBD |   TBD |
+ *        | CobsCodec_Encode, 131 byte message         |   TBD |   TBD |
+ *        | CobsCodec_Decode, 133 byte frame           |   TBD |   TBD |
+ *        | Crc_CalcCrc8, 130 bytes                    |   TBD |   TBD |
+ * @note Build with RAMFUNC_ENABLE=0 to link all functions to flash, e.g. to compare
+ *       cycle counts sampled with ReadCycleCounter() & ComputeCycleCounterDiff().
+ *       Empty for native builds such as the unit tests.
+ */
+#if defined(__GNUC__) && defined(__arm__) && (RAMFUNC_ENABLE == 1)
+    #define RAMFUNC     __attribute__((section(".ramfunc"), noinline, long_call))
+#else
+    #define RAMFUNC
+#endif
+
 /**
  * @brief Mark an argument as unused to prevent compiler warnings.
  */
@@ -10,7 +10,11 @@ SRC += $(DRIVERS_PATH)/crc.c
 SRC += $(DRIVERS_PATH)/exti.c
 SRC += $(DRIVERS_PATH)/core_debug.c
 SRC += $(DRIVERS_PATH)/dma.c
+SRC += $(DRIVERS_PATH)/dma_stream.c
+SRC += $(DRIVERS_PATH)/waveform.c
 SRC += $(DRIVERS_PATH)/watchdog.c
+SRC += $(DRIVERS_PATH)/irq.c
+SRC += $(DRIVERS_PATH)/power.c
 
 # Include paths
 INC += $(DRIVERS_PATH)
\ No newline at end of file
@@ -425,6 +425,40 @@ static inline Bool ClkCtrl_HsiEnabled(void)
     return RCC->CR & RCC_CR_HSION;
 }
 
+
+/**
+ * @brief Await the ready flag for the LSE oscillator.
+ */
+static inline void ClkCtrl_AwaitLseReady(void)
+{
+    while ( !(RCC->BDCR & RCC_BDCR_LSERDY) ) { __NOP(); }
+}
+
+
+/**
+ * @brief Enable the LSE oscillator. The oscillator resides in the backup domain,
+ *        write access to which is enabled through the power controller.
+ * @param AwaitReadyFlag Set to True to await the ready flag after enabling.
+ * @note The LSE keeps running in Stop mode & across resets other than backup domain resets.
+ */
+static inline void ClkCtrl_LseEnable(Bool AwaitReadyFlag)
+{
+    RCC->APB1ENR1 |= RCC_APB1ENR1_PWREN;
+    PWR->CR1 |= PWR_CR1_DBP;
+    RCC->BDCR |= RCC_BDCR_LSEON;
+    if (AwaitReadyFlag) { ClkCtrl_AwaitLseReady(); }
+}
+
+
+/**
+ * @brief Read the status of the LSE oscillator.
+ * @returns True if enabled, False if disabled.
+ */
+static inline Bool ClkCtrl_LseEnabled(void)
+{
+    return RCC->BDCR & RCC_BDCR_LSEON;
+}
+
 /* -------------------------- Public function prototypes --------------------------- */
 
 /**
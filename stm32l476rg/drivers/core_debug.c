@@ -129,10 +129,10 @@ void* GetComparatorAddress(U8 Index)
     void* Address = NULL;
     switch (Index)
     {
-        case 0  : { Address = (void*)DWT->COMPARATOR0; break; }
-        case 1  : { Address = (void*)DWT->COMPARATOR1; break; }
-        case 2  : { Address = (void*)DWT->COMPARATOR2; break; }
-        case 3  : { Address = (void*)DWT->COMPARATOR3; break; }
+        case 0  : { Address = (void*)(uintptr_t)DWT->COMPARATOR0; break; }
+        case 1  : { Address = (void*)(uintptr_t)DWT->COMPARATOR1; break; }
+        case 2  : { Address = (void*)(uintptr_t)DWT->COMPARATOR2; break; }
+        case 3  : { Address = (void*)(uintptr_t)DWT->COMPARATOR3; break; }
         default : { break; }
     }
     return Address;
@@ -157,7 +157,7 @@ WatchpointComparatorStatusEnum DataWatchpointSet(U32* Address, WatchpointCallbac
     }
     else
     {
-        const U32 TmpAddr = (U32)Address;
+        const U32 TmpAddr = (U32)(uintptr_t)Address;
         switch (ComparatorIndex)
         {
             case 0:
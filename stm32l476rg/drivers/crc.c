@@ -32,7 +32,7 @@ void Crc_Crc8Init(const Crc_Crc8ConfigType* Config)
     Crc_Reset();
 }
 
-U8 Crc_CalcCrc8(const U8* Buffer, U8 Length)
+RAMFUNC U8 Crc_CalcCrc8(const U8* Buffer, U8 Length)
 {
     /* Force right-aligned byte access. */
     U8* DataRegPtr = (U8*)&CRC->DR;
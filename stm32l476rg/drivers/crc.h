@@ -76,7 +76,7 @@ void Crc_Crc8Init(const Crc_Crc8ConfigType* Config);
  * @param Length Number of bytes in buffer.
  * @return Calculated CRC-8.
  */
-U8 Crc_CalcCrc8(const U8* Buffer, U8 Length);
+RAMFUNC U8 Crc_CalcCrc8(const U8* Buffer, U8 Length);
 
 /**
  * @brief Set the size of the CRC polynomial.
@@ -7,11 +7,15 @@
 /* ------------------------------- Include directives ------------------------------ */
 #include "dma.h"
 #include "clock_control.h"
+#include "critical_section.h"
+#include "memory_routines.h"
+#include "irq.h"
 
 /* ------------------------ Private preprocessor directives ------------------------ */
 
 #define NOF_DMA_INSTANCES       (2U)
 #define NOF_CHANNELS_PER_DMA    (7U)
+#define NOF_FLAGS_PER_CHANNEL   (4U)
 
 /* --------------------------- Structures & enumerations --------------------------- */
 
@@ -22,17 +26,158 @@ typedef struct Dma_OpaqueHandleType
 {
     DMA_TypeDef* InstanceRegs;         /* Instance control & status registers. */
     DMA_Channel_TypeDef* ChannelRegs;  /* Channel control & status registers. */
+    DMA_Request_TypeDef* RequestRegs;  /* Instance request selection register. */
     Dma_InstanceEnum Instance;         /* Peripheral instance number. */
     Dma_ChannelEnum Channel;           /* DMA channel number. */
-    Bool InUse;                        /* Usage status. */
+    volatile U8 InUse;                 /* Usage status, set through exclusive access. */
+    const void* Owner;                 /* Token given by the claiming owner. */
+    Dma_CallbackType HalfTransferCallback;
+    Dma_CallbackType TransferCompleteCallback;
+    Dma_CallbackType TransferErrorCallback;
+    void* CallbackContext;
 } Dma_OpaqueHandleType;
 
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+/**
+ * @brief Completion status of a synchronous memory-to-memory copy.
+ */
+typedef struct
+{
+    volatile Bool Done;
+    volatile ReturnCodeEnum Status;
+} Dma_MemcpyCompletionType;
+
+/**
+ * @brief Queued memory-to-memory copy job.
+ */
+typedef struct
+{
+    void* Target;                           /* Destination address reported upon completion. */
+    U8* Destination;                        /* Next destination address to transfer to. */
+    const U8* Source;                       /* Next source address to transfer from. */
+    size_t Remaining;                       /* Number of bytes left to transfer. */
+    Dma_MemcpyCallbackType Callback;        /* Asynchronous completion callback. */
+    Dma_MemcpyCompletionType* Completion;   /* Synchronous completion status. */
+} Dma_MemcpyJobType;
+#endif /* DMA_MEMCPY_ENABLE */
+
+/**
+ * @brief Channel able to serve a peripheral DMA request & the matching request selection.
+ */
+typedef struct
+{
+    Dma_RequestEnum Request;
+    Dma_InstanceEnum Instance;
+    Dma_ChannelEnum Channel;
+    U8 Selection;
+} Dma_RequestMapType;
 
 /* ------------------------------- Private variables ------------------------------- */
 
 static Dma_OpaqueHandleType DmaHandles[NOF_DMA_INSTANCES][NOF_CHANNELS_PER_DMA] = { 0 };
 static Bool ModuleInitialized = False;
 
+static const IRQn_Type DmaIrqNums[NOF_DMA_INSTANCES][NOF_CHANNELS_PER_DMA] =
+{
+    {
+        DMA1_Channel1_IRQn, DMA1_Channel2_IRQn, DMA1_Channel3_IRQn, DMA1_Channel4_IRQn,
+        DMA1_Channel5_IRQn, DMA1_Channel6_IRQn, DMA1_Channel7_IRQn
+    },
+    {
+        DMA2_Channel1_IRQn, DMA2_Channel2_IRQn, DMA2_Channel3_IRQn, DMA2_Channel4_IRQn,
+        DMA2_Channel5_IRQn, DMA2_Channel6_IRQn, DMA2_Channel7_IRQn
+    }
+};
+
+/**
+ * @brief DMA request mapping of the STM32L476, see RM0351 DMA1 & DMA2 request tables.
+ *        Requests served by more than one channel are listed in order of preference.
+ */
+static const Dma_RequestMapType DmaRequestMap[] =
+{
+    { DMA_REQUEST_ADC1,         DMA_INSTANCE_1, DMA_CHANNEL_1, 0U },
+    { DMA_REQUEST_ADC1,         DMA_INSTANCE_2, DMA_CHANNEL_3, 0U },
+    { DMA_REQUEST_ADC2,         DMA_INSTANCE_1, DMA_CHANNEL_2, 0U },
+    { DMA_REQUEST_ADC2,         DMA_INSTANCE_2, DMA_CHANNEL_4, 0U },
+    { DMA_REQUEST_ADC3,         DMA_INSTANCE_1, DMA_CHANNEL_3, 0U },
+    { DMA_REQUEST_ADC3,         DMA_INSTANCE_2, DMA_CHANNEL_5, 0U },
+    { DMA_REQUEST_DFSDM1_FLT0,  DMA_INSTANCE_1, DMA_CHANNEL_4, 0U },
+    { DMA_REQUEST_DFSDM1_FLT1,  DMA_INSTANCE_1, DMA_CHANNEL_5, 0U },
+    { DMA_REQUEST_DFSDM1_FLT2,  DMA_INSTANCE_1, DMA_CHANNEL_6, 0U },
+    { DMA_REQUEST_DFSDM1_FLT3,  DMA_INSTANCE_1, DMA_CHANNEL_7, 0U },
+    { DMA_REQUEST_SPI1_RX,      DMA_INSTANCE_1, DMA_CHANNEL_2, 1U },
+    { DMA_REQUEST_SPI1_RX,      DMA_INSTANCE_2, DMA_CHANNEL_3, 4U },
+    { DMA_REQUEST_SPI1_TX,      DMA_INSTANCE_1, DMA_CHANNEL_3, 1U },
+    { DMA_REQUEST_SPI1_TX,      DMA_INSTANCE_2, DMA_CHANNEL_4, 4U },
+    { DMA_REQUEST_SPI2_RX,      DMA_INSTANCE_1, DMA_CHANNEL_4, 1U },
+    { DMA_REQUEST_SPI2_TX,      DMA_INSTANCE_1, DMA_CHANNEL_5, 1U },
+    { DMA_REQUEST_SPI3_RX,      DMA_INSTANCE_2, DMA_CHANNEL_1, 3U },
+    { DMA_REQUEST_SPI3_TX,      DMA_INSTANCE_2, DMA_CHANNEL_2, 3U },
+    { DMA_REQUEST_SAI1_A,       DMA_INSTANCE_2, DMA_CHANNEL_1, 1U },
+    { DMA_REQUEST_SAI1_A,       DMA_INSTANCE_2, DMA_CHANNEL_6, 1U },
+    { DMA_REQUEST_SAI1_B,       DMA_INSTANCE_2, DMA_CHANNEL_2, 1U },
+    { DMA_REQUEST_SAI1_B,       DMA_INSTANCE_2, DMA_CHANNEL_7, 1U },
+    { DMA_REQUEST_SAI2_A,       DMA_INSTANCE_1, DMA_CHANNEL_6, 1U },
+    { DMA_REQUEST_SAI2_A,       DMA_INSTANCE_2, DMA_CHANNEL_3, 1U },
+    { DMA_REQUEST_SAI2_B,       DMA_INSTANCE_1, DMA_CHANNEL_7, 1U },
+    { DMA_REQUEST_SAI2_B,       DMA_INSTANCE_2, DMA_CHANNEL_4, 1U },
+    { DMA_REQUEST_USART1_RX,    DMA_INSTANCE_1, DMA_CHANNEL_5, 2U },
+    { DMA_REQUEST_USART1_RX,    DMA_INSTANCE_2, DMA_CHANNEL_7, 2U },
+    { DMA_REQUEST_USART1_TX,    DMA_INSTANCE_1, DMA_CHANNEL_4, 2U },
+    { DMA_REQUEST_USART1_TX,    DMA_INSTANCE_2, DMA_CHANNEL_6, 2U },
+    { DMA_REQUEST_USART2_RX,    DMA_INSTANCE_1, DMA_CHANNEL_6, 2U },
+    { DMA_REQUEST_USART2_TX,    DMA_INSTANCE_1, DMA_CHANNEL_7, 2U },
+    { DMA_REQUEST_USART3_RX,    DMA_INSTANCE_1, DMA_CHANNEL_3, 2U },
+    { DMA_REQUEST_USART3_TX,    DMA_INSTANCE_1, DMA_CHANNEL_2, 2U },
+    { DMA_REQUEST_UART4_RX,     DMA_INSTANCE_2, DMA_CHANNEL_5, 2U },
+    { DMA_REQUEST_UART4_TX,     DMA_INSTANCE_2, DMA_CHANNEL_3, 2U },
+    { DMA_REQUEST_UART5_RX,     DMA_INSTANCE_2, DMA_CHANNEL_2, 2U },
+    { DMA_REQUEST_UART5_TX,     DMA_INSTANCE_2, DMA_CHANNEL_1, 2U },
+    { DMA_REQUEST_LPUART1_RX,   DMA_INSTANCE_2, DMA_CHANNEL_7, 4U },
+    { DMA_REQUEST_LPUART1_TX,   DMA_INSTANCE_2, DMA_CHANNEL_6, 4U },
+    { DMA_REQUEST_I2C1_RX,      DMA_INSTANCE_1, DMA_CHANNEL_7, 3U },
+    { DMA_REQUEST_I2C1_RX,      DMA_INSTANCE_2, DMA_CHANNEL_6, 5U },
+    { DMA_REQUEST_I2C1_TX,      DMA_INSTANCE_1, DMA_CHANNEL_6, 3U },
+    { DMA_REQUEST_I2C1_TX,      DMA_INSTANCE_2, DMA_CHANNEL_7, 5U },
+    { DMA_REQUEST_I2C2_RX,      DMA_INSTANCE_1, DMA_CHANNEL_5, 3U },
+    { DMA_REQUEST_I2C2_TX,      DMA_INSTANCE_1, DMA_CHANNEL_4, 3U },
+    { DMA_REQUEST_I2C3_RX,      DMA_INSTANCE_1, DMA_CHANNEL_3, 3U },
+    { DMA_REQUEST_I2C3_TX,      DMA_INSTANCE_1, DMA_CHANNEL_2, 3U },
+    { DMA_REQUEST_QUADSPI,      DMA_INSTANCE_1, DMA_CHANNEL_5, 5U },
+    { DMA_REQUEST_QUADSPI,      DMA_INSTANCE_2, DMA_CHANNEL_7, 3U },
+    { DMA_REQUEST_SDMMC1,       DMA_INSTANCE_2, DMA_CHANNEL_4, 7U },
+    { DMA_REQUEST_SDMMC1,       DMA_INSTANCE_2, DMA_CHANNEL_5, 7U },
+    { DMA_REQUEST_SWPMI1_RX,    DMA_INSTANCE_2, DMA_CHANNEL_1, 4U },
+    { DMA_REQUEST_SWPMI1_TX,    DMA_INSTANCE_2, DMA_CHANNEL_2, 4U },
+    { DMA_REQUEST_DAC_CH1,      DMA_INSTANCE_1, DMA_CHANNEL_3, 6U },
+    { DMA_REQUEST_DAC_CH1,      DMA_INSTANCE_2, DMA_CHANNEL_4, 3U },
+    { DMA_REQUEST_DAC_CH2,      DMA_INSTANCE_1, DMA_CHANNEL_4, 5U },
+    { DMA_REQUEST_DAC_CH2,      DMA_INSTANCE_2, DMA_CHANNEL_5, 3U },
+    { DMA_REQUEST_TIM1_UP,      DMA_INSTANCE_1, DMA_CHANNEL_6, 7U },
+    { DMA_REQUEST_TIM2_UP,      DMA_INSTANCE_1, DMA_CHANNEL_2, 4U },
+    { DMA_REQUEST_TIM3_UP,      DMA_INSTANCE_1, DMA_CHANNEL_3, 5U },
+    { DMA_REQUEST_TIM4_UP,      DMA_INSTANCE_1, DMA_CHANNEL_7, 6U },
+    { DMA_REQUEST_TIM5_UP,      DMA_INSTANCE_2, DMA_CHANNEL_2, 5U },
+    { DMA_REQUEST_TIM6_UP,      DMA_INSTANCE_1, DMA_CHANNEL_3, 6U },
+    { DMA_REQUEST_TIM6_UP,      DMA_INSTANCE_2, DMA_CHANNEL_4, 3U },
+    { DMA_REQUEST_TIM7_UP,      DMA_INSTANCE_1, DMA_CHANNEL_4, 5U },
+    { DMA_REQUEST_TIM7_UP,      DMA_INSTANCE_2, DMA_CHANNEL_5, 3U },
+    { DMA_REQUEST_TIM8_UP,      DMA_INSTANCE_2, DMA_CHANNEL_1, 7U },
+    { DMA_REQUEST_TIM15_UP,     DMA_INSTANCE_1, DMA_CHANNEL_5, 7U },
+    { DMA_REQUEST_TIM16_UP,     DMA_INSTANCE_1, DMA_CHANNEL_3, 4U },
+    { DMA_REQUEST_TIM16_UP,     DMA_INSTANCE_1, DMA_CHANNEL_6, 4U },
+    { DMA_REQUEST_TIM17_UP,     DMA_INSTANCE_1, DMA_CHANNEL_1, 5U },
+    { DMA_REQUEST_TIM17_UP,     DMA_INSTANCE_1, DMA_CHANNEL_7, 5U },
+};
+
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+static Dma_MemcpyJobType MemcpyQueue[DMA_MEMCPY_QUEUE_SIZE] = { 0 };
+static volatile U8 MemcpyHead = 0U;
+static volatile U8 MemcpyCount = 0U;
+static size_t MemcpyChunkSize = 0U;
+static Dma_HandleType MemcpyHandle = NULL;
+#endif /* DMA_MEMCPY_ENABLE */
+
 /* ------------------------- Private function declarations ------------------------- */
 
 /**
@@ -136,6 +281,80 @@ static inline void Dma_CircularModeDisable(Dma_HandleType Handle);
  */
 static inline void Dma_SetAddresses(Dma_HandleType Handle, void* PeripheralAddr, void* MemoryAddr);
 
+/**
+ * @brief Dispatch the events of the given channel to its callbacks.
+ * @param Handle DMA peripheral handle.
+ * @note A transfer error disables the channel.
+ */
+static inline void Dma_ChannelInterruptHandler(Dma_HandleType Handle);
+
+static void Dma1_Channel1_IrqHandler(void);
+static void Dma1_Channel2_IrqHandler(void);
+static void Dma1_Channel3_IrqHandler(void);
+static void Dma1_Channel4_IrqHandler(void);
+static void Dma1_Channel5_IrqHandler(void);
+static void Dma1_Channel6_IrqHandler(void);
+static void Dma1_Channel7_IrqHandler(void);
+static void Dma2_Channel1_IrqHandler(void);
+static void Dma2_Channel2_IrqHandler(void);
+static void Dma2_Channel3_IrqHandler(void);
+static void Dma2_Channel4_IrqHandler(void);
+static void Dma2_Channel5_IrqHandler(void);
+static void Dma2_Channel6_IrqHandler(void);
+static void Dma2_Channel7_IrqHandler(void);
+
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+/**
+ * @brief Claim & configure the channel dedicated to memory-to-memory copies.
+ */
+static void Dma_MemcpyInit(void);
+
+/**
+ * @brief Start the next chunk of the given copy job, using the widest transfer
+ *        size permitted by the alignment of the job's addresses & length.
+ * @param Job Copy job to transfer.
+ */
+static void Dma_MemcpyStartChunk(Dma_MemcpyJobType* Job);
+
+/**
+ * @brief Add a copy job to the queue, starting it if the channel is idle.
+ * @param Destination Destination start address.
+ * @param Source Source start address.
+ * @param Length Number of bytes to copy, must be non-zero.
+ * @param Callback Asynchronous completion callback, may be NULL.
+ * @param Completion Synchronous completion status, may be NULL.
+ * @return RC_OK = job queued, RC_ERROR = queue full or driver not initialized.
+ */
+static ReturnCodeEnum Dma_MemcpyEnqueue(void* Destination, const void* Source, size_t Length,
+                                        Dma_MemcpyCallbackType Callback, Dma_MemcpyCompletionType* Completion);
+
+/**
+ * @brief Interrupt handler of the channel dedicated to memory-to-memory copies.
+ *        Advances the current job & starts the next one upon completion.
+ */
+static void Dma_MemcpyIrqHandler(void);
+#endif /* DMA_MEMCPY_ENABLE */
+
+
+/**
+ * @brief Driver interrupt handlers dispatching channel events to the configured callbacks.
+ */
+static const Irq_HandlerType DmaChannelIrqHandlers[NOF_DMA_INSTANCES][NOF_CHANNELS_PER_DMA] =
+{
+    {
+        Dma1_Channel1_IrqHandler, Dma1_Channel2_IrqHandler,
+        Dma1_Channel3_IrqHandler, Dma1_Channel4_IrqHandler,
+        Dma1_Channel5_IrqHandler, Dma1_Channel6_IrqHandler,
+        Dma1_Channel7_IrqHandler
+    },
+    {
+        Dma2_Channel1_IrqHandler, Dma2_Channel2_IrqHandler,
+        Dma2_Channel3_IrqHandler, Dma2_Channel4_IrqHandler,
+        Dma2_Channel5_IrqHandler, Dma2_Channel6_IrqHandler,
+        Dma2_Channel7_IrqHandler
+    }
+};
+
 
 /* -------------------------- Private function definitions ------------------------- */
 
@@ -262,9 +481,95 @@ static inline void Dma_CircularModeDisable(Dma_HandleType Handle)
 
 static inline void Dma_SetAddresses(Dma_HandleType Handle, void* PeripheralAddr, void* MemoryAddr)
 {
-    Handle->ChannelRegs->CPAR = (U32)PeripheralAddr;
-    Handle->ChannelRegs->CMAR = (U32)MemoryAddr;
+    Handle->ChannelRegs->CPAR = (U32)(uintptr_t)PeripheralAddr;
+    Handle->ChannelRegs->CMAR = (U32)(uintptr_t)MemoryAddr;
+}
+
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+static void Dma_MemcpyInit(void)
+{
+    /**
+     * In memory-to-memory mode the channel reads from the peripheral address
+     * & writes to the memory address, both incrementing.
+     */
+    const Dma_ConfigType Config =
+    {
+        .Direction = DMA_TRANSFER_DIR_READ_FROM_PERIPHERAL,
+        .Priority = DMA_CHANNEL_PRIO_LOW,
+        .PeripheralSize = DMA_TRANSFER_SIZE_8BIT,
+        .MemorySize = DMA_TRANSFER_SIZE_8BIT,
+        .PeripheralIncrement = True,
+        .MemoryIncrement = True,
+        .Circular = False,
+        .MemToMem = True,
+        .Request = 0U,
+        .TransferCompleteInterrupt = True,
+        .HalfTransferInterrupt = False,
+        .TransferErrorInterrupt = True
+    };
+    if (Dma_ClaimChannel(&DmaHandles[DMA_MEMCPY_INSTANCE][DMA_MEMCPY_CHANNEL], &MemcpyHandle) != RC_OK) { return; }
+    MemcpyHandle = &DmaHandles[DMA_MEMCPY_INSTANCE][DMA_MEMCPY_CHANNEL];
+    Dma_Configure(MemcpyHandle, &Config);
+
+    (void)Irq_Register(DMA_MEMCPY_IRQn, Dma_MemcpyIrqHandler);
+    NVIC_SetPriority(DMA_MEMCPY_IRQn, DMA_IRQ_PRIO);
+    NVIC_EnableIRQ(DMA_MEMCPY_IRQn);
+}
+
+static void Dma_MemcpyStartChunk(Dma_MemcpyJobType* Job)
+{
+    const uintptr_t Alignment = (uintptr_t)Job->Destination | (uintptr_t)Job->Source;
+    Dma_TransferSizeEnum Size = DMA_TRANSFER_SIZE_8BIT;
+    size_t Width = 1U;
+
+    if ( ((Alignment & 0x3U) == 0U) && (Job->Remaining >= 4U) )
+    {
+        Size = DMA_TRANSFER_SIZE_32BIT;
+        Width = 4U;
+    }
+    else if ( ((Alignment & 0x1U) == 0U) && (Job->Remaining >= 2U) )
+    {
+        Size = DMA_TRANSFER_SIZE_16BIT;
+        Width = 2U;
+    }
+
+    size_t Items = Job->Remaining / Width;
+    if (Items > DMA_MAX_TRANSFER_CNT) { Items = DMA_MAX_TRANSFER_CNT; }
+    MemcpyChunkSize = Items * Width;
+
+    Dma_SetPeripheralTransferSize(MemcpyHandle, Size);
+    Dma_SetMemoryTransferSize(MemcpyHandle, Size);
+    Dma_SetTransfer(MemcpyHandle, Job->Source, Job->Destination, (U16)Items);
+    Dma_ChannelEnable(MemcpyHandle);
+}
+
+static ReturnCodeEnum Dma_MemcpyEnqueue(void* Destination, const void* Source, size_t Length,
+                                        Dma_MemcpyCallbackType Callback, Dma_MemcpyCompletionType* Completion)
+{
+    if (MemcpyHandle == NULL) { return RC_ERROR; }
+
+    CRITICAL_SECTION_ENTER;
+    if (MemcpyCount >= DMA_MEMCPY_QUEUE_SIZE)
+    {
+        CRITICAL_SECTION_EXIT;
+        return RC_ERROR;
+    }
+
+    Dma_MemcpyJobType* const Job = &MemcpyQueue[(MemcpyHead + MemcpyCount) % DMA_MEMCPY_QUEUE_SIZE];
+    Job->Target = Destination;
+    Job->Destination = (U8*)Destination;
+    Job->Source = (const U8*)Source;
+    Job->Remaining = Length;
+    Job->Callback = Callback;
+    Job->Completion = Completion;
+    MemcpyCount++;
+
+    /* The channel is idle whenever the queue was empty, otherwise the ISR picks the job up. */
+    if (MemcpyCount == 1U) { Dma_MemcpyStartChunk(Job); }
+    CRITICAL_SECTION_EXIT;
+    return RC_OK;
 }
+#endif /* DMA_MEMCPY_ENABLE */
 
 /* -------------------------- Public function definitions -------------------------- */
 
@@ -278,13 +583,18 @@ void Dma_Init(void)
             {
                 DmaHandles[Instance][Channel].InstanceRegs = Dma_GetInstanceRegisters(Instance);
                 DmaHandles[Instance][Channel].ChannelRegs = Dma_GetChannelRegisters(Instance, Channel);
+                DmaHandles[Instance][Channel].RequestRegs = (Instance == DMA_INSTANCE_1) ? DMA1_CSELR : DMA2_CSELR;
                 DmaHandles[Instance][Channel].Instance = (Dma_InstanceEnum)Instance;
                 DmaHandles[Instance][Channel].Channel = (Dma_ChannelEnum)Channel;
-                DmaHandles[Instance][Channel].InUse = False;
+                DmaHandles[Instance][Channel].InUse = 0U;
+                DmaHandles[Instance][Channel].Owner = NULL;
             }
         }
         ClkCtrl_PeripheralClockEnable(PCLK_DMA1);
         ClkCtrl_PeripheralClockEnable(PCLK_DMA2);
+        #if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+            Dma_MemcpyInit();
+        #endif
         ModuleInitialized = True;
     }
 }
@@ -300,7 +610,64 @@ Dma_HandleType Dma_GetHandle(Dma_InstanceEnum Instance, Dma_ChannelEnum Channel)
 
 Bool Dma_ChannelIsAvailable(Dma_HandleType Handle)
 {
-    return !Handle->InUse;
+    return (Handle->InUse == 0U);
+}
+
+ReturnCodeEnum Dma_ClaimChannel(Dma_HandleType Handle, const void* Owner)
+{
+    /* Exclusive load/store pair, retried if interrupted between the two */
+    do
+    {
+        if (__LDREXB(&Handle->InUse) != 0U)
+        {
+            __CLREX();
+            return RC_ERROR;
+        }
+    } while (__STREXB(1U, &Handle->InUse) != 0U);
+    __DMB();
+
+    Handle->Owner = Owner;
+    return RC_OK;
+}
+
+Dma_HandleType Dma_ClaimRequestChannel(Dma_RequestEnum Request, const void* Owner, U8* Selection)
+{
+    if (!ModuleInitialized) { return (Dma_HandleType)NULL; }
+
+    for (U8 i = 0; i < (sizeof(DmaRequestMap) / sizeof(DmaRequestMap[0])); i++)
+    {
+        const Dma_RequestMapType* const Entry = &DmaRequestMap[i];
+        if (Entry->Request != Request) { continue; }
+
+        Dma_HandleType const Handle = &DmaHandles[Entry->Instance][Entry->Channel];
+        if (Dma_ClaimChannel(Handle, Owner) == RC_OK)
+        {
+            *Selection = Entry->Selection;
+            return Handle;
+        }
+    }
+    return (Dma_HandleType)NULL;
+}
+
+ReturnCodeEnum Dma_ReleaseChannel(Dma_HandleType Handle, const void* Owner)
+{
+    if ( (Handle->InUse == 0U) || (Handle->Owner != Owner) ) { return RC_ERROR; }
+
+    Dma_ChannelDisable(Handle);
+    Handle->ChannelRegs->CCR &= ~(DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+    Dma_ClearFlags(Handle, DMA_FLAG_ALL);
+    const IRQn_Type Irq = Dma_GetIrqNum(Handle);
+    NVIC_DisableIRQ(Irq);
+    NVIC_ClearPendingIRQ(Irq);
+    Handle->HalfTransferCallback = NULL;
+    Handle->TransferCompleteCallback = NULL;
+    Handle->TransferErrorCallback = NULL;
+    Handle->CallbackContext = NULL;
+    Handle->Owner = NULL;
+
+    __DMB();
+    Handle->InUse = 0U;
+    return RC_OK;
 }
 
 U16 Dma_GetTransferCnt(Dma_HandleType Handle)
@@ -317,3 +684,284 @@ void Dma_ChannelDisable(Dma_HandleType Handle)
 {
     Handle->ChannelRegs->CCR &= ~DMA_CCR_EN;
 }
+
+void Dma_Configure(Dma_HandleType Handle, const Dma_ConfigType* Config)
+{
+    Dma_ChannelDisable(Handle);
+
+    Handle->ChannelRegs->CCR &= ~(DMA_CCR_TCIE | DMA_CCR_HTIE | DMA_CCR_TEIE);
+    Dma_SetTransferDirection(Handle, Config->Direction);
+    Dma_SetChannelPriority(Handle, Config->Priority);
+    Dma_SetPeripheralTransferSize(Handle, Config->PeripheralSize);
+    Dma_SetMemoryTransferSize(Handle, Config->MemorySize);
+    if (Config->PeripheralIncrement) { Dma_PeripheralIncrementModeEnable(Handle); }
+    else { Dma_PeripheralIncrementModeDisable(Handle); }
+    if (Config->MemoryIncrement) { Dma_MemoryIncrementModeEnable(Handle); }
+    else { Dma_MemoryIncrementModeDisable(Handle); }
+    if (Config->Circular) { Dma_CircularModeEnable(Handle); }
+    else { Dma_CircularModeDisable(Handle); }
+    if (Config->MemToMem) { Dma_MemToMemModeEnable(Handle); }
+    else { Dma_MemToMemModeDisable(Handle); }
+    if (Config->TransferCompleteInterrupt) { Handle->ChannelRegs->CCR |= DMA_CCR_TCIE; }
+    if (Config->HalfTransferInterrupt) { Handle->ChannelRegs->CCR |= DMA_CCR_HTIE; }
+    if (Config->TransferErrorInterrupt) { Handle->ChannelRegs->CCR |= DMA_CCR_TEIE; }
+
+    const U32 SelectionShift = DMA_CSELR_C2S_Pos * (U32)Handle->Channel;
+    Handle->RequestRegs->CSELR &= ~(DMA_CSELR_C1S << SelectionShift);
+    Handle->RequestRegs->CSELR |= (((U32)Config->Request << SelectionShift) & (DMA_CSELR_C1S << SelectionShift));
+    Dma_ClearFlags(Handle, DMA_FLAG_ALL);
+
+    Handle->HalfTransferCallback = Config->HalfTransferCallback;
+    Handle->TransferCompleteCallback = Config->TransferCompleteCallback;
+    Handle->TransferErrorCallback = Config->TransferErrorCallback;
+    Handle->CallbackContext = Config->CallbackContext;
+    if ( (Config->HalfTransferCallback != NULL) || (Config->TransferCompleteCallback != NULL) ||
+         (Config->TransferErrorCallback != NULL) )
+    {
+        if (Config->HalfTransferCallback != NULL) { Handle->ChannelRegs->CCR |= DMA_CCR_HTIE; }
+        if (Config->TransferCompleteCallback != NULL) { Handle->ChannelRegs->CCR |= DMA_CCR_TCIE; }
+        if (Config->TransferErrorCallback != NULL) { Handle->ChannelRegs->CCR |= DMA_CCR_TEIE; }
+
+        const IRQn_Type Irq = Dma_GetIrqNum(Handle);
+        (void)Irq_Register(Irq, DmaChannelIrqHandlers[Handle->Instance][Handle->Channel]);
+        NVIC_SetPriority(Irq, DMA_IRQ_PRIO);
+        NVIC_EnableIRQ(Irq);
+    }
+}
+
+void Dma_SetTransfer(Dma_HandleType Handle, volatile const void* PeripheralAddr, void* MemoryAddr, U16 Count)
+{
+    Dma_SetAddresses(Handle, (void*)(uintptr_t)PeripheralAddr, MemoryAddr);
+    Handle->ChannelRegs->CNDTR = (U32)Count;
+}
+
+void Dma_Start(Dma_HandleType Handle, volatile const void* PeripheralAddr, void* MemoryAddr, U16 Count)
+{
+    Dma_ChannelDisable(Handle);
+    Dma_ClearFlags(Handle, DMA_FLAG_ALL);
+    Dma_SetTransfer(Handle, PeripheralAddr, MemoryAddr, Count);
+    Dma_ChannelEnable(Handle);
+}
+
+U8 Dma_GetFlags(Dma_HandleType Handle)
+{
+    const U32 FlagShift = NOF_FLAGS_PER_CHANNEL * (U32)Handle->Channel;
+    return (U8)((Handle->InstanceRegs->ISR >> FlagShift) & DMA_FLAG_ALL);
+}
+
+void Dma_ClearFlags(Dma_HandleType Handle, U8 Flags)
+{
+    const U32 FlagShift = NOF_FLAGS_PER_CHANNEL * (U32)Handle->Channel;
+    Handle->InstanceRegs->IFCR = ((U32)(Flags & DMA_FLAG_ALL) << FlagShift);
+}
+
+IRQn_Type Dma_GetIrqNum(Dma_HandleType Handle)
+{
+    return DmaIrqNums[Handle->Instance][Handle->Channel];
+}
+
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+ReturnCodeEnum Dma_MemcpyAsync(void* Destination, const void* Source, size_t Length, Dma_MemcpyCallbackType Callback)
+{
+    /* Nothing to copy, the callback would have to run in the caller's context */
+    if (Length == 0U) { return RC_OK; }
+    return Dma_MemcpyEnqueue(Destination, Source, Length, Callback, NULL);
+}
+
+ReturnCodeEnum Dma_Memcpy(void* Destination, const void* Source, size_t Length)
+{
+    Dma_MemcpyCompletionType Completion = { .Done = False, .Status = RC_OK };
+
+    if ( (Length < DMA_MEMCPY_CPU_THRESHOLD) ||
+         (Dma_MemcpyEnqueue(Destination, Source, Length, NULL, &Completion) != RC_OK) )
+    {
+        memcpy(Destination, Source, Length);
+        return RC_OK;
+    }
+
+    while (!Completion.Done) { }
+    return Completion.Status;
+}
+
+Bool Dma_MemcpyIsIdle(void)
+{
+    return (MemcpyCount == 0U);
+}
+#endif /* DMA_MEMCPY_ENABLE */
+
+/* ------------------------------- Interrupt handlers ------------------------------ */
+
+static inline void Dma_ChannelInterruptHandler(Dma_HandleType Handle)
+{
+    const U8 Flags = Dma_GetFlags(Handle);
+    Dma_ClearFlags(Handle, Flags);
+
+    if ( (Flags & DMA_FLAG_TRANSFER_ERROR) && (Handle->TransferErrorCallback != NULL) )
+    {
+        Handle->TransferErrorCallback(Handle, Handle->CallbackContext);
+    }
+    if ( (Flags & DMA_FLAG_HALF_TRANSFER) && (Handle->HalfTransferCallback != NULL) )
+    {
+        Handle->HalfTransferCallback(Handle, Handle->CallbackContext);
+    }
+    if ( (Flags & DMA_FLAG_TRANSFER_COMPLETE) && (Handle->TransferCompleteCallback != NULL) )
+    {
+        Handle->TransferCompleteCallback(Handle, Handle->CallbackContext);
+    }
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 1.
+ */
+static void Dma1_Channel1_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_1]);
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 2.
+ */
+static void Dma1_Channel2_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_2]);
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 3.
+ */
+static void Dma1_Channel3_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_3]);
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 4.
+ */
+static void Dma1_Channel4_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_4]);
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 5.
+ */
+static void Dma1_Channel5_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_5]);
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 6.
+ */
+static void Dma1_Channel6_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_6]);
+}
+
+/**
+ * @brief Interrupt handler for DMA1 channel 7.
+ */
+static void Dma1_Channel7_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_1][DMA_CHANNEL_7]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 1.
+ */
+static void Dma2_Channel1_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_1]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 2.
+ */
+static void Dma2_Channel2_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_2]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 3.
+ */
+static void Dma2_Channel3_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_3]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 4.
+ */
+static void Dma2_Channel4_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_4]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 5.
+ */
+static void Dma2_Channel5_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_5]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 6.
+ */
+static void Dma2_Channel6_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_6]);
+}
+
+/**
+ * @brief Interrupt handler for DMA2 channel 7.
+ */
+static void Dma2_Channel7_IrqHandler(void)
+{
+    Dma_ChannelInterruptHandler(&DmaHandles[DMA_INSTANCE_2][DMA_CHANNEL_7]);
+}
+
+
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+static void Dma_MemcpyIrqHandler(void)
+{
+    const U8 Flags = Dma_GetFlags(MemcpyHandle);
+    Dma_ClearFlags(MemcpyHandle, DMA_FLAG_ALL);
+    Dma_ChannelDisable(MemcpyHandle);
+    if (MemcpyCount == 0U) { return; }
+
+    Dma_MemcpyJobType* Job = &MemcpyQueue[MemcpyHead];
+    ReturnCodeEnum Status = RC_OK;
+    if ((Flags & DMA_FLAG_TRANSFER_ERROR) != 0U)
+    {
+        Status = RC_ERROR;
+    }
+    else
+    {
+        Job->Destination += MemcpyChunkSize;
+        Job->Source += MemcpyChunkSize;
+        Job->Remaining -= MemcpyChunkSize;
+        if (Job->Remaining > 0U)
+        {
+            Dma_MemcpyStartChunk(Job);
+            return;
+        }
+    }
+
+    /* Retire the job & keep the channel busy before notifying the owner. */
+    void* const Target = Job->Target;
+    const Dma_MemcpyCallbackType Callback = Job->Callback;
+    Dma_MemcpyCompletionType* const Completion = Job->Completion;
+    MemcpyHead = (U8)((MemcpyHead + 1U) % DMA_MEMCPY_QUEUE_SIZE);
+    MemcpyCount--;
+    if (MemcpyCount > 0U) { Dma_MemcpyStartChunk(&MemcpyQueue[MemcpyHead]); }
+
+    if (Completion != NULL)
+    {
+        Completion->Status = Status;
+        Completion->Done = True;
+    }
+    if (Callback != NULL) { Callback(Target, Status); }
+}
+#endif /* DMA_MEMCPY_ENABLE */
@@ -11,6 +11,28 @@
 #include "typedef.h"
 #include "stm32l4xx.h"
 
+/* ---------------------------- Preprocessor directives ---------------------------- */
+#define DMA_IRQ_PRIO                (6U)
+#define DMA_MAX_TRANSFER_CNT        (0xFFFFU)
+
+/**
+ * @brief Memory-to-memory copy service configuration. The service occupies one
+ *        DMA channel exclusively, the IRQ number must match the selected
+ *        instance & channel pair.
+ */
+#define DMA_MEMCPY_ENABLE           (1U)
+#define DMA_MEMCPY_INSTANCE         (DMA_INSTANCE_2)
+#define DMA_MEMCPY_CHANNEL          (DMA_CHANNEL_1)
+#define DMA_MEMCPY_IRQn             (DMA2_Channel1_IRQn)
+#define DMA_MEMCPY_QUEUE_SIZE       (8U)
+
+/**
+ * @brief Copies shorter than this are performed by the CPU in Dma_Memcpy(),
+ *        where the cost of setting up the channel & taking the interrupt
+ *        outweighs the gain of offloading the copy.
+ */
+#define DMA_MEMCPY_CPU_THRESHOLD    (256U)
+
 /* --------------------------- Structures & enumerations --------------------------- */
 
 /**
@@ -71,11 +93,122 @@ typedef enum
     DMA_TRANSFER_DIR_ENUM_LIMIT
 } Dma_TransferDirectionEnum;
 
+/**
+ * @brief Enumeration of peripheral DMA requests served by the channel allocator,
+ *        see Dma_ClaimRequestChannel().
+ */
+typedef enum
+{
+    DMA_REQUEST_ADC1 = 0x0U,
+    DMA_REQUEST_ADC2,
+    DMA_REQUEST_ADC3,
+    DMA_REQUEST_DFSDM1_FLT0,
+    DMA_REQUEST_DFSDM1_FLT1,
+    DMA_REQUEST_DFSDM1_FLT2,
+    DMA_REQUEST_DFSDM1_FLT3,
+    DMA_REQUEST_SPI1_RX,
+    DMA_REQUEST_SPI1_TX,
+    DMA_REQUEST_SPI2_RX,
+    DMA_REQUEST_SPI2_TX,
+    DMA_REQUEST_SPI3_RX,
+    DMA_REQUEST_SPI3_TX,
+    DMA_REQUEST_SAI1_A,
+    DMA_REQUEST_SAI1_B,
+    DMA_REQUEST_SAI2_A,
+    DMA_REQUEST_SAI2_B,
+    DMA_REQUEST_USART1_RX,
+    DMA_REQUEST_USART1_TX,
+    DMA_REQUEST_USART2_RX,
+    DMA_REQUEST_USART2_TX,
+    DMA_REQUEST_USART3_RX,
+    DMA_REQUEST_USART3_TX,
+    DMA_REQUEST_UART4_RX,
+    DMA_REQUEST_UART4_TX,
+    DMA_REQUEST_UART5_RX,
+    DMA_REQUEST_UART5_TX,
+    DMA_REQUEST_LPUART1_RX,
+    DMA_REQUEST_LPUART1_TX,
+    DMA_REQUEST_I2C1_RX,
+    DMA_REQUEST_I2C1_TX,
+    DMA_REQUEST_I2C2_RX,
+    DMA_REQUEST_I2C2_TX,
+    DMA_REQUEST_I2C3_RX,
+    DMA_REQUEST_I2C3_TX,
+    DMA_REQUEST_QUADSPI,
+    DMA_REQUEST_SDMMC1,
+    DMA_REQUEST_SWPMI1_RX,
+    DMA_REQUEST_SWPMI1_TX,
+    DMA_REQUEST_DAC_CH1,
+    DMA_REQUEST_DAC_CH2,
+    DMA_REQUEST_TIM1_UP,
+    DMA_REQUEST_TIM2_UP,
+    DMA_REQUEST_TIM3_UP,
+    DMA_REQUEST_TIM4_UP,
+    DMA_REQUEST_TIM5_UP,
+    DMA_REQUEST_TIM6_UP,
+    DMA_REQUEST_TIM7_UP,
+    DMA_REQUEST_TIM8_UP,
+    DMA_REQUEST_TIM15_UP,
+    DMA_REQUEST_TIM16_UP,
+    DMA_REQUEST_TIM17_UP,
+    DMA_REQUEST_ENUM_LIMIT
+} Dma_RequestEnum;
+
+/**
+ * @brief Enumeration of DMA channel status flags, as returned by Dma_GetFlags().
+ */
+typedef enum
+{
+    DMA_FLAG_GLOBAL = 0x1U,             /* Any of the flags below is set. */
+    DMA_FLAG_TRANSFER_COMPLETE = 0x2U,
+    DMA_FLAG_HALF_TRANSFER = 0x4U,
+    DMA_FLAG_TRANSFER_ERROR = 0x8U,
+    DMA_FLAG_ALL = 0xFU
+} Dma_FlagEnum;
+
 /**
  * @brief Opaque DMA handle type.
  */
 typedef struct Dma_OpaqueHandleType* Dma_HandleType;
 
+/**
+ * @brief DMA channel event callback, invoked from interrupt context.
+ * @param Handle DMA peripheral handle of the channel raising the event.
+ * @param Context User context given in the channel configuration.
+ */
+typedef void (*Dma_CallbackType)(Dma_HandleType Handle, void* Context);
+
+/**
+ * @brief DMA channel configuration structure. Should any callback be given the channel
+ *        interrupt is handled by the driver, otherwise the interrupt handler is left to the user.
+ */
+typedef struct
+{
+    Dma_TransferDirectionEnum Direction;
+    Dma_ChannelPriorityEnum Priority;
+    Dma_TransferSizeEnum PeripheralSize;
+    Dma_TransferSizeEnum MemorySize;
+    Bool PeripheralIncrement;
+    Bool MemoryIncrement;
+    Bool Circular;
+    Bool MemToMem;
+    U8 Request;                         /* Peripheral request number, see DMA request mapping in RM0351. */
+    Bool TransferCompleteInterrupt;
+    Bool HalfTransferInterrupt;
+    Bool TransferErrorInterrupt;
+    Dma_CallbackType HalfTransferCallback;      /* Enables the interrupt, may be NULL. */
+    Dma_CallbackType TransferCompleteCallback;  /* Enables the interrupt, may be NULL. */
+    Dma_CallbackType TransferErrorCallback;     /* Enables the interrupt, may be NULL. */
+    void* CallbackContext;                      /* Passed to the callbacks. */
+} Dma_ConfigType;
+
+/**
+ * @brief Memory-to-memory copy completion callback, invoked from interrupt context.
+ * @param Destination Destination address of the completed copy.
+ * @param Status RC_OK = copy completed, RC_ERROR = DMA transfer error.
+ */
+typedef void (*Dma_MemcpyCallbackType)(void* Destination, ReturnCodeEnum Status);
+
 /* -------------------------- Public function declarations ------------------------- */
 
 /**
@@ -97,10 +230,39 @@ Dma_HandleType Dma_GetHandle(Dma_InstanceEnum Instance, Dma_ChannelEnum Channel)
 /**
  * @brief Check availablility of the given DMA channel.
  * @param Handle DMA peripheral handle.
- * @return True = available, False = not available.
+ * @return True = available, False = claimed.
  */
 Bool Dma_ChannelIsAvailable(Dma_HandleType Handle);
 
+/**
+ * @brief Claim exclusive use of the given DMA channel. Safe to call concurrently
+ *        from threads & interrupt handlers.
+ * @param Handle DMA peripheral handle.
+ * @param Owner Token identifying the owner, e.g. the handle of the claiming driver.
+ * @return RC_OK = claimed, RC_ERROR = already claimed.
+ */
+ReturnCodeEnum Dma_ClaimChannel(Dma_HandleType Handle, const void* Owner);
+
+/**
+ * @brief Claim any free DMA channel able to serve the given peripheral request,
+ *        according to the STM32L476 request mapping.
+ * @param Request Peripheral DMA request.
+ * @param Owner Token identifying the owner, e.g. the handle of the claiming driver.
+ * @param Selection Request selection value to configure the channel with, see Dma_ConfigType.
+ * @return Handle of the claimed channel, NULL if all channels serving the request are claimed
+ *         or the driver is not initialized.
+ */
+Dma_HandleType Dma_ClaimRequestChannel(Dma_RequestEnum Request, const void* Owner, U8* Selection);
+
+/**
+ * @brief Release a claimed DMA channel. The channel is stopped, its interrupts &
+ *        callbacks are disabled.
+ * @param Handle DMA peripheral handle.
+ * @param Owner Token given when claiming the channel.
+ * @return RC_OK = released, RC_ERROR = not claimed by the given owner.
+ */
+ReturnCodeEnum Dma_ReleaseChannel(Dma_HandleType Handle, const void* Owner);
+
 /**
  * @brief Read the "number of data to transfer" register of the given DMA channel.
  * @param Handle DMA peripheral handle.
@@ -120,4 +282,87 @@ void Dma_ChannelEnable(Dma_HandleType Handle);
  */
 void Dma_ChannelDisable(Dma_HandleType Handle);
 
+/**
+ * @brief Configure the given claimed DMA channel. The channel is disabled
+ *        while being configured and left disabled. Installs the driver interrupt handler
+ *        & enables the channel interrupt if any callback is given.
+ * @param Handle DMA peripheral handle.
+ * @param Config Channel configuration.
+ */
+void Dma_Configure(Dma_HandleType Handle, const Dma_ConfigType* Config);
+
+/**
+ * @brief Set the addresses & number of data items of the next transfer.
+ *        The channel must be disabled.
+ * @param Handle DMA peripheral handle.
+ * @param PeripheralAddr Peripheral address, source address in memory-to-memory mode.
+ * @param MemoryAddr Memory address.
+ * @param Count Number of data items to transfer.
+ */
+void Dma_SetTransfer(Dma_HandleType Handle, volatile const void* PeripheralAddr, void* MemoryAddr, U16 Count);
+
+/**
+ * @brief Start a transfer on the given configured DMA channel, stopping any ongoing one.
+ * @param Handle DMA peripheral handle.
+ * @param PeripheralAddr Peripheral address, source address in memory-to-memory mode.
+ * @param MemoryAddr Memory address.
+ * @param Count Number of data items to transfer.
+ */
+void Dma_Start(Dma_HandleType Handle, volatile const void* PeripheralAddr, void* MemoryAddr, U16 Count);
+
+/**
+ * @brief Read the status flags of the given DMA channel.
+ * @param Handle DMA peripheral handle.
+ * @return Bitwise OR of Dma_FlagEnum values.
+ */
+U8 Dma_GetFlags(Dma_HandleType Handle);
+
+/**
+ * @brief Clear status flags of the given DMA channel.
+ * @param Handle DMA peripheral handle.
+ * @param Flags Bitwise OR of Dma_FlagEnum values.
+ */
+void Dma_ClearFlags(Dma_HandleType Handle, U8 Flags);
+
+/**
+ * @brief Get the IRQ number of the given DMA channel.
+ * @param Handle DMA peripheral handle.
+ * @return IRQ number.
+ */
+IRQn_Type Dma_GetIrqNum(Dma_HandleType Handle);
+
+#if defined(DMA_MEMCPY_ENABLE) && (DMA_MEMCPY_ENABLE == 1U)
+/**
+ * @brief Queue an asynchronous memory-to-memory copy on the dedicated DMA channel.
+ *        Queued copies are performed in order, one at a time.
+ * @param Destination Destination start address.
+ * @param Source Source start address.
+ * @param Length Number of bytes to copy.
+ * @param Callback Function called upon completion, may be NULL.
+ * @return RC_OK = copy queued or nothing to copy, RC_ERROR = queue full or driver not initialized.
+ * @note Both buffers must remain valid & untouched until the callback is invoked.
+ *       A zero length copy returns RC_OK at once & never invokes the callback.
+ *       The regions must not overlap. The transfer width is chosen from the mutual
+ *       alignment of the buffers, word aligned buffers copy fastest.
+ */
+ReturnCodeEnum Dma_MemcpyAsync(void* Destination, const void* Source, size_t Length, Dma_MemcpyCallbackType Callback);
+
+/**
+ * @brief Synchronous memory-to-memory copy. Copies shorter than DMA_MEMCPY_CPU_THRESHOLD,
+ *        or issued while the copy queue is full, are performed by the CPU.
+ * @param Destination Destination start address.
+ * @param Source Source start address.
+ * @param Length Number of bytes to copy.
+ * @return RC_OK = copy completed, RC_ERROR = DMA transfer error.
+ * @warning Busy-waits for completion, must not be called from interrupt context.
+ */
+ReturnCodeEnum Dma_Memcpy(void* Destination, const void* Source, size_t Length);
+
+/**
+ * @brief Check if all queued memory-to-memory copies have completed.
+ * @return True = no copies pending, False = copies pending.
+ */
+Bool Dma_MemcpyIsIdle(void);
+#endif /* DMA_MEMCPY_ENABLE */
+
 #endif /* DMA_H */
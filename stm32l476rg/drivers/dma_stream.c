@@ -0,0 +1,324 @@
+/**
+ * @file dma_stream.c
+ *
+ * @brief Double-buffered (ping-pong) DMA streaming.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "dma_stream.h"
+#include "critical_section.h"
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+#include "osal.h"
+#endif /* DMA_STREAM_RTOS_ENABLE */
+
+/* ------------------------- Local preprocessor definitions ------------------------ */
+#define DMA_STREAM_NOF_BLOCKS   (2U)
+
+/*  -------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Ownership of a stream block.
+ */
+typedef enum
+{
+    DMA_STREAM_BLOCK_FREE = 0x0U,       /* Owned by the stream, being or about to be transferred. */
+    DMA_STREAM_BLOCK_READY = 0x1U,      /* Completed, awaiting the consumer. */
+    DMA_STREAM_BLOCK_HELD = 0x2U        /* Owned by the consumer. */
+} DmaStream_BlockStateEnum;
+
+/**
+ * @brief DMA stream handle structure.
+ */
+struct DmaStream_OpaqueHandleType
+{
+    Bool InUse;
+    Dma_HandleType Dma;
+    volatile const void* PeripheralAddr;
+    U8* Blocks[DMA_STREAM_NOF_BLOCKS];
+    U16 BlockLength;
+    DmaStream_CallbackType Callback;
+    void* CallbackContext;
+    volatile Bool Running;
+    volatile DmaStream_BlockStateEnum BlockStates[DMA_STREAM_NOF_BLOCKS];
+    U8 NextAcquire;                     /* Index of the oldest block not yet handed out. */
+    U8 NextRelease;                     /* Index of the oldest block handed out. */
+    volatile U32 Overruns;
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+    Osal_ThreadHandleType Waiter;       /* Thread blocked in DmaStream_AcquireBlock(), NULL if none. */
+#endif /* DMA_STREAM_RTOS_ENABLE */
+};
+
+/* --------------------------------- Local variables ------------------------------- */
+static struct DmaStream_OpaqueHandleType DmaStreams[DMA_STREAM_MAX_NOF_STREAMS] = { 0 };
+
+/* ------------------------- Private function declarations ------------------------- */
+
+/**
+ * @brief Hand the given completed block to the consumer & check the block the
+ *        channel continues with for an overrun.
+ * @param Stream DMA stream handle.
+ * @param Block Index of the completed block.
+ * @note Only use inside of interrupt context.
+ */
+static void DmaStream_BlockComplete(DmaStream_HandleType Stream, U8 Block);
+
+/**
+ * @brief Channel half transfer callback, the first block is completed.
+ * @param Handle DMA peripheral handle.
+ * @param Context DMA stream handle.
+ */
+static void DmaStream_HalfTransferCallback(Dma_HandleType Handle, void* Context);
+
+/**
+ * @brief Channel transfer complete callback, the second block is completed.
+ * @param Handle DMA peripheral handle.
+ * @param Context DMA stream handle.
+ */
+static void DmaStream_TransferCompleteCallback(Dma_HandleType Handle, void* Context);
+
+/**
+ * @brief Channel transfer error callback, stops the stream.
+ * @param Handle DMA peripheral handle.
+ * @param Context DMA stream handle.
+ */
+static void DmaStream_TransferErrorCallback(Dma_HandleType Handle, void* Context);
+
+/**
+ * @brief Wake the thread blocked in DmaStream_AcquireBlock(), if any.
+ * @param Stream DMA stream handle.
+ * @note Only use inside of interrupt context.
+ */
+static inline void DmaStream_Wake(DmaStream_HandleType Stream);
+
+/**
+ * @brief Take ownership of the oldest completed block, if any.
+ * @param Stream DMA stream handle.
+ * @return Start of the block, NULL if no block is ready.
+ * @note Only use inside of a critical section.
+ */
+static void* DmaStream_TakeBlock(DmaStream_HandleType Stream);
+
+/* -------------------------- Private function definitions ------------------------- */
+
+static inline void DmaStream_Wake(DmaStream_HandleType Stream)
+{
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+    if (Stream->Waiter != NULL)
+    {
+        Osal_NotifyFromISR(Stream->Waiter);
+        Stream->Waiter = NULL;
+    }
+#else
+    UNUSED(Stream);
+#endif /* DMA_STREAM_RTOS_ENABLE */
+}
+
+static void* DmaStream_TakeBlock(DmaStream_HandleType Stream)
+{
+    if (Stream->BlockStates[Stream->NextAcquire] != DMA_STREAM_BLOCK_READY) { return NULL; }
+
+    Stream->BlockStates[Stream->NextAcquire] = DMA_STREAM_BLOCK_HELD;
+    void* const Block = Stream->Blocks[Stream->NextAcquire];
+    Stream->NextAcquire ^= 1U;
+    return Block;
+}
+
+static void DmaStream_BlockComplete(DmaStream_HandleType Stream, U8 Block)
+{
+    /* The channel has moved on to the other block, which must be free to not overwrite data */
+    if (Stream->BlockStates[Block ^ 1U] != DMA_STREAM_BLOCK_FREE) { Stream->Overruns++; }
+
+    /* A block owned by the consumer while being transferred has already been counted */
+    if (Stream->BlockStates[Block] != DMA_STREAM_BLOCK_FREE) { return; }
+
+    if (Stream->Callback != NULL)
+    {
+        Stream->BlockStates[Block] = DMA_STREAM_BLOCK_HELD;
+        Stream->NextAcquire = Block ^ 1U;
+        Stream->Callback(Stream, Stream->Blocks[Block], Stream->CallbackContext);
+    }
+    else
+    {
+        Stream->BlockStates[Block] = DMA_STREAM_BLOCK_READY;
+        DmaStream_Wake(Stream);
+    }
+}
+
+static void DmaStream_HalfTransferCallback(Dma_HandleType Handle, void* Context)
+{
+    UNUSED(Handle);
+    DmaStream_BlockComplete((DmaStream_HandleType)Context, 0U);
+}
+
+static void DmaStream_TransferCompleteCallback(Dma_HandleType Handle, void* Context)
+{
+    UNUSED(Handle);
+    DmaStream_BlockComplete((DmaStream_HandleType)Context, 1U);
+}
+
+static void DmaStream_TransferErrorCallback(Dma_HandleType Handle, void* Context)
+{
+    DmaStream_HandleType Stream = (DmaStream_HandleType)Context;
+    Dma_ChannelDisable(Handle);
+    Stream->Running = False;
+    DmaStream_Wake(Stream);
+}
+
+/* -------------------------- Public function definitions -------------------------- */
+
+DmaStream_HandleType DmaStream_Init(const DmaStream_ConfigType* Config)
+{
+    if ( (Config->BlockLength == 0U) || (Config->BlockLength > (DMA_MAX_TRANSFER_CNT / DMA_STREAM_NOF_BLOCKS)) )
+    {
+        return (DmaStream_HandleType)NULL;
+    }
+
+    DmaStream_HandleType Stream = (DmaStream_HandleType)NULL;
+    CRITICAL_SECTION_ENTER;
+    for (U8 i = 0; i < DMA_STREAM_MAX_NOF_STREAMS; i++)
+    {
+        if (!DmaStreams[i].InUse)
+        {
+            DmaStreams[i].InUse = True;
+            Stream = &DmaStreams[i];
+            break;
+        }
+    }
+    CRITICAL_SECTION_EXIT;
+    if (Stream == NULL) { return (DmaStream_HandleType)NULL; }
+
+    Dma_Init();
+    U8 Selection;
+    Stream->Dma = Dma_ClaimRequestChannel(Config->Request, Stream, &Selection);
+    if (Stream->Dma == NULL)
+    {
+        Stream->InUse = False;
+        return (DmaStream_HandleType)NULL;
+    }
+
+    const U32 BlockSize = (U32)Config->BlockLength << (U32)Config->DataSize;
+    Stream->PeripheralAddr = Config->PeripheralAddr;
+    Stream->Blocks[0] = (U8*)Config->Buffer;
+    Stream->Blocks[1] = (U8*)Config->Buffer + BlockSize;
+    Stream->BlockLength = Config->BlockLength;
+    Stream->Callback = Config->Callback;
+    Stream->CallbackContext = Config->CallbackContext;
+    Stream->Running = False;
+    Stream->Overruns = 0U;
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+    Stream->Waiter = NULL;
+#endif /* DMA_STREAM_RTOS_ENABLE */
+
+    const Dma_ConfigType DmaCfg =
+    {
+        .Direction = Config->Direction,
+        .Priority = Config->Priority,
+        .PeripheralSize = Config->DataSize,
+        .MemorySize = Config->DataSize,
+        .PeripheralIncrement = False,
+        .MemoryIncrement = True,
+        .Circular = True,
+        .MemToMem = False,
+        .Request = Selection,
+        .TransferCompleteInterrupt = False,
+        .HalfTransferInterrupt = False,
+        .TransferErrorInterrupt = False,
+        .HalfTransferCallback = DmaStream_HalfTransferCallback,
+        .TransferCompleteCallback = DmaStream_TransferCompleteCallback,
+        .TransferErrorCallback = DmaStream_TransferErrorCallback,
+        .CallbackContext = Stream
+    };
+    Dma_Configure(Stream->Dma, &DmaCfg);
+    return Stream;
+}
+
+void DmaStream_Deinit(DmaStream_HandleType Stream)
+{
+    DmaStream_Stop(Stream);
+    (void)Dma_ReleaseChannel(Stream->Dma, Stream);
+    Stream->Dma = (Dma_HandleType)NULL;
+    Stream->InUse = False;
+}
+
+void DmaStream_Start(DmaStream_HandleType Stream)
+{
+    Dma_ChannelDisable(Stream->Dma);
+    for (U8 i = 0; i < DMA_STREAM_NOF_BLOCKS; i++) { Stream->BlockStates[i] = DMA_STREAM_BLOCK_FREE; }
+    Stream->NextAcquire = 0U;
+    Stream->NextRelease = 0U;
+    Stream->Overruns = 0U;
+    Stream->Running = True;
+    Dma_Start(Stream->Dma, Stream->PeripheralAddr, Stream->Blocks[0], (U16)(Stream->BlockLength * DMA_STREAM_NOF_BLOCKS));
+}
+
+void DmaStream_Stop(DmaStream_HandleType Stream)
+{
+    CRITICAL_SECTION_ENTER;
+    Dma_ChannelDisable(Stream->Dma);
+    Stream->Running = False;
+    for (U8 i = 0; i < DMA_STREAM_NOF_BLOCKS; i++)
+    {
+        if (Stream->BlockStates[i] == DMA_STREAM_BLOCK_READY) { Stream->BlockStates[i] = DMA_STREAM_BLOCK_FREE; }
+    }
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+    const Osal_ThreadHandleType Waiter = Stream->Waiter;
+    Stream->Waiter = NULL;
+#endif /* DMA_STREAM_RTOS_ENABLE */
+    CRITICAL_SECTION_EXIT;
+
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+    /* Thread context, the waiter is notified outside of the critical section */
+    if (Waiter != NULL) { Osal_Notify(Waiter); }
+#endif /* DMA_STREAM_RTOS_ENABLE */
+}
+
+Bool DmaStream_IsRunning(DmaStream_HandleType Stream)
+{
+    return Stream->Running;
+}
+
+void* DmaStream_TryAcquireBlock(DmaStream_HandleType Stream)
+{
+    CRITICAL_SECTION_ENTER;
+    void* const Block = DmaStream_TakeBlock(Stream);
+    CRITICAL_SECTION_EXIT;
+    return Block;
+}
+
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+void* DmaStream_AcquireBlock(DmaStream_HandleType Stream, U32 Timeout_ms)
+{
+    Osal_NotifyClear();
+    CRITICAL_SECTION_ENTER;
+    void* Block = DmaStream_TakeBlock(Stream);
+    const Bool MustWait = (Block == NULL) && Stream->Running;
+    if (MustWait) { Stream->Waiter = Osal_GetCurrentThread(); }
+    CRITICAL_SECTION_EXIT;
+
+    if (MustWait)
+    {
+        (void)Osal_NotifyWait(Timeout_ms);
+        CRITICAL_SECTION_ENTER;
+        Stream->Waiter = NULL;
+        CRITICAL_SECTION_EXIT;
+        Block = DmaStream_TryAcquireBlock(Stream);
+    }
+    return Block;
+}
+#endif /* DMA_STREAM_RTOS_ENABLE */
+
+void DmaStream_ReleaseBlock(DmaStream_HandleType Stream)
+{
+    CRITICAL_SECTION_ENTER;
+    if (Stream->BlockStates[Stream->NextRelease] == DMA_STREAM_BLOCK_HELD)
+    {
+        Stream->BlockStates[Stream->NextRelease] = DMA_STREAM_BLOCK_FREE;
+        Stream->NextRelease ^= 1U;
+    }
+    CRITICAL_SECTION_EXIT;
+}
+
+U32 DmaStream_GetNofOverruns(DmaStream_HandleType Stream)
+{
+    return Stream->Overruns;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file dma_stream.h
+ *
+ * @brief Interface for double-buffered (ping-pong) DMA streaming.
+ *
+ *        A circular DMA channel runs over a buffer split in two blocks. Each time
+ *        the channel completes a block it is handed to the consumer, either through
+ *        a callback or by waking a thread blocked in DmaStream_AcquireBlock(), while
+ *        the channel carries on with the other block. The consumer owns the block until
+ *        it calls DmaStream_ReleaseBlock(), should the channel wrap around onto a block
+ *        still owned by the consumer an overrun is counted.
+ */
+
+#ifndef DMA_STREAM_H
+#define DMA_STREAM_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "typedef.h"
+#include "dma.h"
+
+/* ---------------------------- Preprocessor directives ---------------------------- */
+#define DMA_STREAM_MAX_NOF_STREAMS  (4U)
+
+/**
+ * @brief Set to 1 to allow threads to block in DmaStream_AcquireBlock().
+ */
+#define DMA_STREAM_RTOS_ENABLE      (1U)
+
+/* --------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Opaque DMA stream handle type.
+ */
+typedef struct DmaStream_OpaqueHandleType* DmaStream_HandleType;
+
+/**
+ * @brief Block ready callback, invoked from interrupt context.
+ * @param Stream DMA stream handle.
+ * @param Block Start of the completed block, owned by the consumer until released.
+ * @param Context User context given in the stream configuration.
+ */
+typedef void (*DmaStream_CallbackType)(DmaStream_HandleType Stream, void* Block, void* Context);
+
+/**
+ * @brief DMA stream configuration structure.
+ */
+typedef struct
+{
+    Dma_RequestEnum Request;                /* Peripheral request pacing the stream. */
+    volatile const void* PeripheralAddr;    /* Peripheral data register. */
+    Dma_TransferDirectionEnum Direction;
+    Dma_TransferSizeEnum DataSize;          /* Size of the data items, peripheral & memory. */
+    Dma_ChannelPriorityEnum Priority;
+    void* Buffer;                           /* Two consecutive blocks, aligned to the data size. */
+    U16 BlockLength;                        /* Number of data items per block. */
+    DmaStream_CallbackType Callback;        /* May be NULL, blocks are then acquired by a thread. */
+    void* CallbackContext;                  /* Passed to the callback. */
+} DmaStream_ConfigType;
+
+/* -------------------------- Public function declarations ------------------------- */
+
+/**
+ * @brief Claim a DMA channel serving the configured request & set up a stream on it.
+ * @param Config Stream configuration.
+ * @return Handle used to interact with the stream, NULL if no stream or DMA channel is
+ *         available or the block length is invalid.
+ */
+DmaStream_HandleType DmaStream_Init(const DmaStream_ConfigType* Config);
+
+/**
+ * @brief Stop the given stream & release its DMA channel.
+ * @param Stream DMA stream handle.
+ */
+void DmaStream_Deinit(DmaStream_HandleType Stream);
+
+/**
+ * @brief Start streaming from the first block, all blocks are handed back to the stream.
+ * @param Stream DMA stream handle.
+ */
+void DmaStream_Start(DmaStream_HandleType Stream);
+
+/**
+ * @brief Stop streaming. Blocks ready but not yet acquired are discarded & a thread
+ *        blocked in DmaStream_AcquireBlock() is woken.
+ * @param Stream DMA stream handle.
+ * @note Only use outside of interrupt context.
+ */
+void DmaStream_Stop(DmaStream_HandleType Stream);
+
+/**
+ * @brief Check if the given stream is running, a transfer error stops the stream.
+ * @param Stream DMA stream handle.
+ * @return True = running, False = stopped.
+ */
+Bool DmaStream_IsRunning(DmaStream_HandleType Stream);
+
+/**
+ * @brief Take ownership of the oldest completed block, if any.
+ * @param Stream DMA stream handle.
+ * @return Start of the block, NULL if no block is ready.
+ */
+void* DmaStream_TryAcquireBlock(DmaStream_HandleType Stream);
+
+#if defined(DMA_STREAM_RTOS_ENABLE) && (DMA_STREAM_RTOS_ENABLE == 1U)
+/**
+ * @brief Take ownership of the oldest completed block, blocking the calling thread
+ *        until a block is ready, the stream stops or the timeout expires.
+ * @param Stream DMA stream handle.
+ * @param Timeout_ms Maximum time to wait, OSAL_WAIT_FOREVER to wait indefinitely.
+ * @return Start of the block, NULL upon timeout or if the stream is stopped.
+ * @note Only one thread at a time may wait on a stream.
+ */
+void* DmaStream_AcquireBlock(DmaStream_HandleType Stream, U32 Timeout_ms);
+#endif /* DMA_STREAM_RTOS_ENABLE */
+
+/**
+ * @brief Hand the oldest block owned by the consumer back to the stream.
+ *        Blocks are released in the order they were handed out.
+ * @param Stream DMA stream handle.
+ */
+void DmaStream_ReleaseBlock(DmaStream_HandleType Stream);
+
+/**
+ * @brief Get the number of blocks completed while the block next in line was still
+ *        owned by the consumer, i.e. the number of times data was overwritten.
+ * @param Stream DMA stream handle.
+ * @return Number of overruns since the stream was started.
+ */
+U32 DmaStream_GetNofOverruns(DmaStream_HandleType Stream);
+
+#endif /* DMA_STREAM_H */
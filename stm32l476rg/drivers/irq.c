@@ -0,0 +1,101 @@
+/**
+ * @file irq.c
+ *
+ * @brief Interrupt vector table relocation & runtime interrupt handler registration.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "irq.h"
+#include "startup.h"
+
+/* ------------------------ Private preprocessor directives ------------------------ */
+
+/**
+ * @brief Number of entries in the vector table, including the initial stack pointer.
+ */
+#define NOF_VECTORS             (sizeof(VectorTableType) / sizeof(uintptr_t))
+
+/**
+ * @brief Offset of IRQ number 0 from the start of the vector table.
+ */
+#define IRQ_VECTOR_OFFSET       (16)
+
+/**
+ * @brief Lowest IRQ number with a vector table entry (NMI).
+ */
+#define IRQ_NUMBER_MIN          (NonMaskableInt_IRQn)
+
+/**
+ * @brief VTOR requires the table to be aligned to its size rounded up to a power of two,
+ *        512 bytes on target. Scaled with the vector size for host builds.
+ */
+#define VECTOR_TABLE_ALIGNMENT  (128U * sizeof(uintptr_t))
+StaticAssert(sizeof(VectorTableType) <= VECTOR_TABLE_ALIGNMENT, "Vector table exceeds VECTOR_TABLE_ALIGNMENT!");
+
+/* ------------------------------- Private variables ------------------------------- */
+
+static volatile uintptr_t RamVectorTable[NOF_VECTORS] ALIGN(VECTOR_TABLE_ALIGNMENT) = { 0 };
+static Bool ModuleInitialized = False;
+
+/* ------------------------- Private function declarations ------------------------- */
+
+/**
+ * @brief Check that the given IRQ number has an entry in the vector table.
+ * @param Irq Interrupt or system exception number.
+ * @return True = valid, False = invalid.
+ */
+static inline Bool Irq_IsValid(IRQn_Type Irq);
+
+/* -------------------------- Private function definitions ------------------------- */
+
+static inline Bool Irq_IsValid(IRQn_Type Irq)
+{
+    return ( ((S32)Irq >= (S32)IRQ_NUMBER_MIN) && (((S32)Irq + IRQ_VECTOR_OFFSET) < (S32)NOF_VECTORS) );
+}
+
+/* -------------------------- Public function definitions -------------------------- */
+
+void Irq_Init(void)
+{
+    if (!ModuleInitialized)
+    {
+        const uintptr_t* const FlashVectorTable = (const uintptr_t*)&VectorTable;
+        for (U32 i = 0; i < NOF_VECTORS; i++)
+        {
+            RamVectorTable[i] = FlashVectorTable[i];
+        }
+
+        SCB->VTOR = (U32)(uintptr_t)RamVectorTable;
+        __DSB();
+        __ISB();
+        ModuleInitialized = True;
+    }
+}
+
+ReturnCodeEnum Irq_Register(IRQn_Type Irq, Irq_HandlerType Handler)
+{
+    if ( !ModuleInitialized || !Irq_IsValid(Irq) || (Handler == NULL) ) { return RC_ERROR; }
+
+    RamVectorTable[(S32)Irq + IRQ_VECTOR_OFFSET] = (uintptr_t)Handler;
+    __DSB();
+    return RC_OK;
+}
+
+void Irq_Unregister(IRQn_Type Irq)
+{
+    if ( !ModuleInitialized || !Irq_IsValid(Irq) ) { return; }
+
+    const uintptr_t* const FlashVectorTable = (const uintptr_t*)&VectorTable;
+    RamVectorTable[(S32)Irq + IRQ_VECTOR_OFFSET] = FlashVectorTable[(S32)Irq + IRQ_VECTOR_OFFSET];
+    __DSB();
+}
+
+Irq_HandlerType Irq_GetHandler(IRQn_Type Irq)
+{
+    if (!Irq_IsValid(Irq)) { return (Irq_HandlerType)NULL; }
+
+    const uintptr_t Entry = ModuleInitialized ?
+                            RamVectorTable[(S32)Irq + IRQ_VECTOR_OFFSET] :
+                            ((const uintptr_t*)&VectorTable)[(S32)Irq + IRQ_VECTOR_OFFSET];
+    return (Irq_HandlerType)Entry;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file irq.h
+ *
+ * @brief Interrupt vector table relocation & runtime interrupt handler registration.
+ */
+
+#ifndef IRQ_H
+#define IRQ_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "typedef.h"
+#include "stm32l4xx.h"
+
+/* --------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Interrupt handler function pointer.
+ */
+typedef void (*Irq_HandlerType)(void);
+
+/* -------------------------- Public function declarations ------------------------- */
+
+/**
+ * @brief Copy the vector table from flash to RAM & point SCB->VTOR at the copy.
+ *        Called from the reset handler before main(), once .bss is initialized.
+ */
+void Irq_Init(void);
+
+/**
+ * @brief Install an interrupt handler in the RAM vector table.
+ * @param Irq Interrupt or system exception number.
+ * @param Handler Interrupt handler function.
+ * @return RC_OK = handler installed, RC_ERROR = invalid IRQ number or handler,
+ *         or vector table not relocated.
+ * @note Does not touch the NVIC, enabling & prioritizing the interrupt is up to the caller.
+ */
+ReturnCodeEnum Irq_Register(IRQn_Type Irq, Irq_HandlerType Handler);
+
+/**
+ * @brief Restore the default handler from the flash vector table.
+ * @param Irq Interrupt or system exception number.
+ */
+void Irq_Unregister(IRQn_Type Irq);
+
+/**
+ * @brief Get the interrupt handler currently installed for the given interrupt.
+ * @param Irq Interrupt or system exception number.
+ * @return Interrupt handler, NULL for invalid IRQ numbers.
+ */
+Irq_HandlerType Irq_GetHandler(IRQn_Type Irq);
+
+#endif /* IRQ_H */
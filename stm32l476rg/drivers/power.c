@@ -0,0 +1,49 @@
+/**
+ * @file power.c
+ *
+ * @brief Low-power mode control.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "power.h"
+#include "clock_control.h"
+#include "critical_section.h"
+
+/* ------------------------- Local preprocessor definitions ------------------------ */
+#define POWER_RESTORED_CLOCKS   (RCC_CR_HSION | RCC_CR_HSEON | RCC_CR_PLLON | RCC_CR_PLLSAI1ON | RCC_CR_PLLSAI2ON)
+
+/* -------------------------- Public function definitions -------------------------- */
+
+void Power_EnterStop2(void)
+{
+    CRITICAL_SECTION_ENTER;
+
+    /* Stop mode turns off all oscillators but LSE & LSI, the system wakes up on MSI */
+    const U32 Clocks = RCC->CR & POWER_RESTORED_CLOCKS;
+    const ClkCtrl_SysclkInputEnum SysclkInput = (ClkCtrl_SysclkInputEnum)((RCC->CFGR & RCC_CFGR_SWS_Msk) >> RCC_CFGR_SWS_Pos);
+
+    ClkCtrl_PeripheralClockEnable(PCLK_PWR);
+    PWR->CR1 = (PWR->CR1 & ~PWR_CR1_LPMS_Msk) | PWR_CR1_LPMS_STOP2;
+    PWR->SCR = PWR_SCR_CWUF;
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+    __DSB();
+    __WFI();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+    if (Clocks & RCC_CR_HSION) { ClkCtrl_HsiEnable(True); }
+    if (Clocks & RCC_CR_HSEON)
+    {
+        RCC->CR |= RCC_CR_HSEON;
+        while ( !(RCC->CR & RCC_CR_HSERDY) ) { __NOP(); }
+    }
+    if (Clocks & RCC_CR_PLLON)      { ClkCtrl_PllEnable(PLL_MAIN, True); }
+    if (Clocks & RCC_CR_PLLSAI1ON)  { ClkCtrl_PllEnable(PLL_SAI1, True); }
+    if (Clocks & RCC_CR_PLLSAI2ON)  { ClkCtrl_PllEnable(PLL_SAI2, True); }
+    if (SysclkInput != SYSCLK_INPUT_MSI)
+    {
+        ClkCtrl_SetSysclkInput(SysclkInput);
+        while ( ((RCC->CFGR & RCC_CFGR_SWS_Msk) >> RCC_CFGR_SWS_Pos) != (U32)SysclkInput ) { __NOP(); }
+    }
+
+    CRITICAL_SECTION_EXIT;
+}
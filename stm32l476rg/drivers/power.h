@@ -0,0 +1,26 @@
+/**
+ * @file power.h
+ *
+ * @brief Interface for low-power mode control.
+ */
+
+#ifndef POWER_H
+#define POWER_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "typedef.h"
+#include "stm32l4xx.h"
+
+/* -------------------------- Public function declarations ------------------------- */
+
+/**
+ * @brief Enter Stop 2 mode & await a wake-up event, e.g. from LPUART1 configured
+ *        with an HSI or LSE kernel clock & a Stop mode wake-up event.
+ *        The oscillators, PLLs & SYSCLK source in use are restored before returning,
+ *        the interrupt causing the wake-up is serviced thereafter.
+ * @note SysTick is halted in Stop mode, should be called with the RTOS scheduler
+ *       suspended or from a tickless idle hook.
+ */
+void Power_EnterStop2(void);
+
+#endif /* POWER_H */
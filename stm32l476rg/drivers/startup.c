@@ -9,6 +9,7 @@
 /* ------------------------------- Include directives ------------------------------ */
 #include "startup.h"
 #include "osal.h"
+#include "irq.h"
 
 /* ------------------------ Symbols defined in linker script ----------------------- */
 extern U32 _data_loadaddr;
@@ -22,6 +23,131 @@ extern U32 _fixed_size_heap_end;
 extern U32 _ram2;
 extern U32 _eram2;
 extern U32 _ram2_loadaddr;
+extern U32 _ramfunc;
+extern U32 _eramfunc;
+extern U32 _ramfunc_loadaddr;
+
+/**
+ * @brief Defined as 0 through the linker flag --defsym=_fixed_size_heap_zero_init=0
+ *        to skip zero-filling the fixed size heap section. Declared weak so that the
+ *        compiler can't assume a non-zero address.
+ */
+extern const U8 _fixed_size_heap_zero_init[] __attribute__((weak));
+
+/* Weak declarations of Cortex-M4 system exception handlers */
+void NMIHandler(void) __attribute__((weak, alias("NullHandler")));
+void HardFaultHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void MemManageHandler(void) __attribute__((weak, alias("NullHandler")));
+void BusFaultHandler(void) __attribute__((weak, alias("NullHandler")));
+void UsageFaultHandler(void) __attribute__((weak, alias("NullHandler")));
+void SVCallHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DebugMonHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void PendSVHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SysTickHandler(void) __attribute__((weak, alias("NullHandler")));
+
+/* Weak declarations of STM32L476RG interrupt handlers */
+void WWDG_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void PVD_PVM_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TAMP_STAMP_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void RTC_WKUP_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void FLASH_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void RCC_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI0_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI4_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel4_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel5_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel6_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA1_Channel7_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void ADC1_2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void CAN1_TX_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void CAN1_RX0_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void CAN1_RX1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void CAN1_SCE_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI9_5_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM1_BRK_TIM15_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM1_UP_TIM16_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM1_TRG_COM_TIM17_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM1_CC_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM4_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void I2C1_EV_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void I2C1_ER_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void I2C2_EV_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void I2C2_ER_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SPI1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SPI2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void USART1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void USART2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void USART3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void EXTI15_10_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void RTC_Alarm_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DFSDM1_FLT3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM8_BRK_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM8_UP_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM8_TRG_COM_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM8_CC_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void ADC3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void FMC_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SDMMC1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM5_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SPI3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void UART4_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void UART5_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM6_DAC_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TIM7_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel3_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel4_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel5_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DFSDM1_FLT0_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DFSDM1_FLT1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DFSDM1_FLT2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void COMP_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void LPTIM1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void LPTIM2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void OTG_FS_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel6_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void DMA2_Channel7_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void LPUART1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void QUADSPI_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void I2C3_EV_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void I2C3_ER_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SAI1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SAI2_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void SWPMI1_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void TSC_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void LCD_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void RNG_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+void FPU_IRQHandler(void) __attribute__((weak, alias("BlockingHandler")));
+
+/* ------------------------------- Private variables ------------------------------- */
+
+static U32 BootTimestamps[BOOT_STAGE_ENUM_LIMIT] = { 0 };
+
+/* ------------------------- Private function declarations ------------------------- */
+
+/**
+ * @brief Copy a word aligned section from its load address into RAM.
+ * @param Dest Start of section in RAM.
+ * @param DestEnd End of section in RAM.
+ * @param Src Start of section load address.
+ */
+static inline void Startup_CopySection(U32* Dest, const U32* DestEnd, const U32* Src);
+
+/**
+ * @brief Zero-fill a word aligned section.
+ * @param Dest Start of section.
+ * @param DestEnd End of section.
+ */
+static inline void Startup_ZeroSection(U32* Dest, const U32* DestEnd);
 
 /* Vector table definition */
 VectorTableType VectorTable SECTION(IVT_SECTION) =
@@ -132,39 +258,76 @@ VectorTableType VectorTable SECTION(IVT_SECTION) =
     .ISR[FPU_IRQn] = FPU_IRQHandler,
 };
 
+/* -------------------------- Private function definitions ------------------------- */
+
 /**
- * @brief System reset handler. First code to execute upon reset.
+ * @note The loops below are unrolled to four words per iteration, which GCC
+ *       turns into LDM/STM pairs. Sections are word aligned & padded by the
+ *       linker script, so no byte handling is needed.
  */
-void ResetHandler(void)
+NO_LIBCALL_DETECTION
+static inline void Startup_CopySection(U32* Dest, const U32* DestEnd, const U32* Src)
 {
-    /* Initialize .data section */
-    volatile U32* SrcPtr = &_data_loadaddr;
-    volatile U32* DestPtr = &_data;
-    for (; DestPtr < &_edata; SrcPtr++, DestPtr++)
+    while ((DestEnd - Dest) >= 4)
     {
-        *DestPtr = *SrcPtr;
+        const U32 Word0 = Src[0];
+        const U32 Word1 = Src[1];
+        const U32 Word2 = Src[2];
+        const U32 Word3 = Src[3];
+        Dest[0] = Word0;
+        Dest[1] = Word1;
+        Dest[2] = Word2;
+        Dest[3] = Word3;
+        Dest += 4;
+        Src += 4;
     }
+    while (Dest < DestEnd) { *Dest++ = *Src++; }
+}
 
-    /* Zero-fill .bss section */
-    while (DestPtr < &_ebss)
+NO_LIBCALL_DETECTION
+static inline void Startup_ZeroSection(U32* Dest, const U32* DestEnd)
+{
+    while ((DestEnd - Dest) >= 4)
     {
-        *DestPtr++ = 0;
+        Dest[0] = 0U;
+        Dest[1] = 0U;
+        Dest[2] = 0U;
+        Dest[3] = 0U;
+        Dest += 4;
     }
+    while (Dest < DestEnd) { *Dest++ = 0U; }
+}
+
+/* -------------------------- Public function definitions -------------------------- */
+
+/**
+ * @brief System reset handler. First code to execute upon reset.
+ */
+void ResetHandler(void)
+{
+    /* Start the cycle counter from zero, it is not cleared by a system reset. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
-    /* Zero-fill fixed size heap section */
-    DestPtr = &_fixed_size_heap_start;
-    while (DestPtr < &_fixed_size_heap_end)
+    /* Initialize .data & .bss sections, .bss follows .data directly. */
+    Startup_CopySection(&_data, &_edata, &_data_loadaddr);
+    Startup_ZeroSection(&_edata, &_ebss);
+
+    /* Zero-fill fixed size heap section unless disabled at link time. */
+    if ((uintptr_t)_fixed_size_heap_zero_init != 0U)
     {
-        *DestPtr++ = 0;
+        Startup_ZeroSection(&_fixed_size_heap_start, &_fixed_size_heap_end);
     }
 
     /* Initialize RAM2 section */
-    SrcPtr = &_ram2_loadaddr;
-    DestPtr = &_ram2;
-    for (; DestPtr < &_eram2; SrcPtr++, DestPtr++)
-    {
-        *DestPtr = *SrcPtr;
-    }
+    Startup_CopySection(&_ram2, &_eram2, &_ram2_loadaddr);
+
+    /* Copy functions executing from RAM2 */
+    Startup_CopySection(&_ramfunc, &_eramfunc, &_ramfunc_loadaddr);
+
+    /* Relocate the vector table to RAM to allow runtime handler registration */
+    Irq_Init();
 
     /* Ensure 8-byte stack alignment on exception entry */
     SCB->CCR |= SCB_CCR_STKALIGN_Msk;
@@ -172,9 +335,20 @@ void ResetHandler(void)
     /* Enable floating point co-processor */
     SCB->CPACR |= (0x0FUL << 20U);
 
+    Startup_SetBootTimestamp(BOOT_STAGE_RESET);
     (void)main();
 }
 
+void Startup_SetBootTimestamp(Startup_BootStageEnum Stage)
+{
+    if (Stage < BOOT_STAGE_ENUM_LIMIT) { BootTimestamps[Stage] = DWT->CYCCNT; }
+}
+
+U32 Startup_GetBootTimestamp(Startup_BootStageEnum Stage)
+{
+    return (Stage < BOOT_STAGE_ENUM_LIMIT) ? BootTimestamps[Stage] : 0U;
+}
+
 /**
  * @brief Blocking placeholder exception/interrupt handler.
  */
@@ -10,9 +10,20 @@
 #include "pin.h"
 #include "fifo.h"
 #include "critical_section.h"
+#include "irq.h"
+#include "dma.h"
+#if defined(UART_RTOS_ENABLE) && (UART_RTOS_ENABLE == 1U)
+#include "osal.h"
+#endif /* UART_RTOS_ENABLE */
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+#include "core_debug.h"
+#endif /* UART_TIMESTAMP_ENABLE */
 
 /* ------------------------- Local preprocessor definitions ------------------------ */
 #define INVALID_IRQn    ((IRQn_Type)0xFFU)
+#define UART_LINE_ERROR_FLAGS   (USART_ISR_ORE | USART_ISR_FE | USART_ISR_NE | USART_ISR_PE)
+#define UART_DE_TIME_MAX        (0x1FU)
+#define UART_BUFFER_SIZE_VALID(Size)    ( ((Size) != 0U) && ((Size) <= 0x8000U) && (((Size) & ((Size) - 1U)) == 0U) )
 
 /*  -------------------------- Structures & enumerations --------------------------- */
 
@@ -20,18 +31,58 @@ struct Uart_OpaqueHandleType
 {
     USART_TypeDef* Instance;
     FifoType* TxFifo;
-    U8* TxBuffer;
+    U8* TxBuffer;           /* Driver owned output buffer, replaced by a caller owned one if configured. */
+    U16 TxBufferSize;
     FifoType* RxFifo;
-    U8* RxBuffer;
-    Bool TxBusy;
+    U8* RxBuffer;           /* Driver owned input buffer, replaced by a caller owned one if configured. */
+    U16 RxBufferSize;
+    volatile Bool TxBusy;
     Bool RxBusy;
+    Dma_HandleType RxDma;   /* Circular reception channel, NULL in interrupt mode. */
+    U16 RxDmaPosition;      /* Buffer index up to which received data is published. */
+    Dma_HandleType TxDma;   /* Transmission channel, NULL in interrupt mode. */
+    U16 TxDmaCount;         /* Number of bytes of the ongoing DMA transmission. */
+    volatile U32 ErrorCounts[UART_ERROR_ENUM_LIMIT];
+    U32 PendingBrr;                 /* Baud rate register value applied once transmission completes. */
+    volatile Bool BaudRatePending;
+    Bool RtsFlowControl;    /* Stall reception instead of dropping data when input buffer is full. */
+#if defined(UART_RTOS_ENABLE) && (UART_RTOS_ENABLE == 1U)
+    Osal_ThreadHandleType RxWaiter; /* Thread blocked in Uart_ReadTimeout(), NULL if none. */
+    U16 RxThreshold;                /* Number of input buffer bytes waking the reader. */
+    Osal_ThreadHandleType TxWaiter; /* Thread blocked in Uart_WriteTimeout() or Uart_AwaitBaudRateSwitch(), NULL if none. */
+    U16 TxThreshold;                /* Number of free output buffer bytes waking the writer. */
+#endif /* UART_RTOS_ENABLE */
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    volatile U32 RxTimestamp;       /* Cycle count at which received data was last published. */
+    volatile U32 TxTimestamp;       /* Cycle count at which the output buffer was last drained. */
+    volatile Bool TxTimestampValid; /* TxTimestamp not yet read. */
+#endif /* UART_TIMESTAMP_ENABLE */
 };
 
 /* --------------------------------- Local variables ------------------------------- */
 
+/**
+ * @brief Line error flags & the counters they increment. The ICR clear flags
+ *        share bit positions with the ISR flags.
+ */
+static const struct
+{
+    U32 Flag;
+    Uart_ErrorEnum Error;
+} UartLineErrors[] =
+{
+    { USART_ISR_ORE, UART_ERROR_OVERRUN },
+    { USART_ISR_FE,  UART_ERROR_FRAMING },
+    { USART_ISR_NE,  UART_ERROR_NOISE   },
+    { USART_ISR_PE,  UART_ERROR_PARITY  }
+};
+StaticAssert( (USART_ICR_ORECF == USART_ISR_ORE) && (USART_ICR_FECF == USART_ISR_FE) &&
+              (USART_ICR_NECF == USART_ISR_NE) && (USART_ICR_PECF == USART_ISR_PE),
+              "Line error clear flags must match status flags" );
+
 #if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
-static U8 Usart1TxBuffer[UART_TX_BUFFER_SIZE] = { 0 };
-static U8 Usart1RxBuffer[UART_RX_BUFFER_SIZE] = { 0 };
+static U8 Usart1TxBuffer[USART1_TX_BUFFER_SIZE] = { 0 };
+static U8 Usart1RxBuffer[USART1_RX_BUFFER_SIZE] = { 0 };
 static FifoType Usart1TxFifo = { 0 };
 static FifoType Usart1RxFifo = { 0 };
 static struct Uart_OpaqueHandleType Usart1Handle =
@@ -39,16 +90,20 @@ static struct Uart_OpaqueHandleType Usart1Handle =
     .Instance = USART1,
     .TxFifo = &Usart1TxFifo,
     .TxBuffer = Usart1TxBuffer,
+    .TxBufferSize = sizeof(Usart1TxBuffer),
     .TxBusy = False,
     .RxFifo = &Usart1RxFifo,
     .RxBuffer = Usart1RxBuffer,
+    .RxBufferSize = sizeof(Usart1RxBuffer),
     .RxBusy = False,
 };
+StaticAssert( UART_BUFFER_SIZE_VALID(USART1_TX_BUFFER_SIZE) && UART_BUFFER_SIZE_VALID(USART1_RX_BUFFER_SIZE),
+              "USART1 buffer sizes must be powers of two up to 32768" );
 #endif /* USART1_ENABLE */
 
 #if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
-static U8 Usart2TxBuffer[UART_TX_BUFFER_SIZE] = { 0 };
-static U8 Usart2RxBuffer[UART_RX_BUFFER_SIZE] = { 0 };
+static U8 Usart2TxBuffer[USART2_TX_BUFFER_SIZE] = { 0 };
+static U8 Usart2RxBuffer[USART2_RX_BUFFER_SIZE] = { 0 };
 static FifoType Usart2TxFifo = { 0 };
 static FifoType Usart2RxFifo = { 0 };
 static struct Uart_OpaqueHandleType Usart2Handle =
@@ -56,16 +111,20 @@ static struct Uart_OpaqueHandleType Usart2Handle =
     .Instance = USART2,
     .TxFifo = &Usart2TxFifo,
     .TxBuffer = Usart2TxBuffer,
+    .TxBufferSize = sizeof(Usart2TxBuffer),
     .TxBusy = False,
     .RxFifo = &Usart2RxFifo,
     .RxBuffer = Usart2RxBuffer,
+    .RxBufferSize = sizeof(Usart2RxBuffer),
     .RxBusy = False,
 };
+StaticAssert( UART_BUFFER_SIZE_VALID(USART2_TX_BUFFER_SIZE) && UART_BUFFER_SIZE_VALID(USART2_RX_BUFFER_SIZE),
+              "USART2 buffer sizes must be powers of two up to 32768" );
 #endif /* USART2_ENABLE */
 
-#if defined(USART3_ENABLE) && (USART3_ENALBE == 1U)
-static U8 Usart3TxBuffer[UART_TX_BUFFER_SIZE] = { 0 };
-static U8 Usart3RxBuffer[UART_RX_BUFFER_SIZE] = { 0 };
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+static U8 Usart3TxBuffer[USART3_TX_BUFFER_SIZE] = { 0 };
+static U8 Usart3RxBuffer[USART3_RX_BUFFER_SIZE] = { 0 };
 static FifoType Usart3TxFifo = { 0 };
 static FifoType Usart3RxFifo = { 0 };
 static struct Uart_OpaqueHandleType Usart3Handle =
@@ -73,16 +132,20 @@ static struct Uart_OpaqueHandleType Usart3Handle =
     .Instance = USART3,
     .TxFifo = &Usart3TxFifo,
     .TxBuffer = Usart3TxBuffer,
+    .TxBufferSize = sizeof(Usart3TxBuffer),
     .TxBusy = False,
     .RxFifo = &Usart3RxFifo,
     .RxBuffer = Usart3RxBuffer,
+    .RxBufferSize = sizeof(Usart3RxBuffer),
     .RxBusy = False,
 };
+StaticAssert( UART_BUFFER_SIZE_VALID(USART3_TX_BUFFER_SIZE) && UART_BUFFER_SIZE_VALID(USART3_RX_BUFFER_SIZE),
+              "USART3 buffer sizes must be powers of two up to 32768" );
 #endif /* USART3_ENABLE */
 
 #if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
-static U8 Uart4TxBuffer[UART_TX_BUFFER_SIZE] = { 0 };
-static U8 Uart4RxBuffer[UART_RX_BUFFER_SIZE] = { 0 };
+static U8 Uart4TxBuffer[UART4_TX_BUFFER_SIZE] = { 0 };
+static U8 Uart4RxBuffer[UART4_RX_BUFFER_SIZE] = { 0 };
 static FifoType Uart4TxFifo = { 0 };
 static FifoType Uart4RxFifo = { 0 };
 static struct Uart_OpaqueHandleType Uart4Handle =
@@ -90,16 +153,20 @@ static struct Uart_OpaqueHandleType Uart4Handle =
     .Instance = UART4,
     .TxFifo = &Uart4TxFifo,
     .TxBuffer = Uart4TxBuffer,
+    .TxBufferSize = sizeof(Uart4TxBuffer),
     .TxBusy = False,
     .RxFifo = &Uart4RxFifo,
     .RxBuffer = Uart4RxBuffer,
+    .RxBufferSize = sizeof(Uart4RxBuffer),
     .RxBusy = False,
 };
+StaticAssert( UART_BUFFER_SIZE_VALID(UART4_TX_BUFFER_SIZE) && UART_BUFFER_SIZE_VALID(UART4_RX_BUFFER_SIZE),
+              "UART4 buffer sizes must be powers of two up to 32768" );
 #endif /* UART4_ENABLE */
 
 #if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
-static U8 Uart5TxBuffer[UART_TX_BUFFER_SIZE] = { 0 };
-static U8 Uart5RxBuffer[UART_RX_BUFFER_SIZE] = { 0 };
+static U8 Uart5TxBuffer[UART5_TX_BUFFER_SIZE] = { 0 };
+static U8 Uart5RxBuffer[UART5_RX_BUFFER_SIZE] = { 0 };
 static FifoType Uart5TxFifo = { 0 };
 static FifoType Uart5RxFifo = { 0 };
 static struct Uart_OpaqueHandleType Uart5Handle =
@@ -107,16 +174,20 @@ static struct Uart_OpaqueHandleType Uart5Handle =
     .Instance = UART5,
     .TxFifo = &Uart5TxFifo,
     .TxBuffer = Uart5TxBuffer,
+    .TxBufferSize = sizeof(Uart5TxBuffer),
     .TxBusy = False,
     .RxFifo = &Uart5RxFifo,
     .RxBuffer = Uart5RxBuffer,
+    .RxBufferSize = sizeof(Uart5RxBuffer),
     .RxBusy = False,
 };
+StaticAssert( UART_BUFFER_SIZE_VALID(UART5_TX_BUFFER_SIZE) && UART_BUFFER_SIZE_VALID(UART5_RX_BUFFER_SIZE),
+              "UART5 buffer sizes must be powers of two up to 32768" );
 #endif /* UART5_ENABLE */
 
 #if defined (LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
-static U8 Lpuart1TxBuffer[UART_TX_BUFFER_SIZE] = { 0 };
-static U8 Lpuart1RxBuffer[UART_RX_BUFFER_SIZE] = { 0 };
+static U8 Lpuart1TxBuffer[LPUART1_TX_BUFFER_SIZE] = { 0 };
+static U8 Lpuart1RxBuffer[LPUART1_RX_BUFFER_SIZE] = { 0 };
 static FifoType Lpuart1TxFifo = { 0 };
 static FifoType Lpuart1RxFifo = { 0 };
 static struct Uart_OpaqueHandleType Lpuart1Handle =
@@ -124,13 +195,91 @@ static struct Uart_OpaqueHandleType Lpuart1Handle =
     .Instance = LPUART1,
     .TxFifo = &Lpuart1TxFifo,
     .TxBuffer = Lpuart1TxBuffer,
+    .TxBufferSize = sizeof(Lpuart1TxBuffer),
     .TxBusy = False,
     .RxFifo = &Lpuart1RxFifo,
     .RxBuffer = Lpuart1RxBuffer,
+    .RxBufferSize = sizeof(Lpuart1RxBuffer),
     .RxBusy = False,
 };
+StaticAssert( UART_BUFFER_SIZE_VALID(LPUART1_TX_BUFFER_SIZE) && UART_BUFFER_SIZE_VALID(LPUART1_RX_BUFFER_SIZE),
+              "LPUART1 buffer sizes must be powers of two up to 32768" );
+#endif /* LPUART1_ENABLE */
+
+
+/* ------------------------- Interrupt handler declarations ------------------------ */
+
+#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+RAMFUNC static void Usart1_IrqHandler(void);
+#endif /* USART1_ENABLE */
+
+#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+RAMFUNC static void Usart2_IrqHandler(void);
+#endif /* USART2_ENABLE */
+
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+RAMFUNC static void Usart3_IrqHandler(void);
+#endif /* USART3_ENABLE */
+
+#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+RAMFUNC static void Uart4_IrqHandler(void);
+#endif /* UART4_ENABLE */
+
+#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+RAMFUNC static void Uart5_IrqHandler(void);
+#endif /* UART5_ENABLE */
+
+#if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+RAMFUNC static void Lpuart1_IrqHandler(void);
+#endif /* LPUART1_ENABLE */
+
+#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+RAMFUNC static void Usart1_RxDmaIrqHandler(void);
+#endif /* USART1_ENABLE */
+
+#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+RAMFUNC static void Usart2_RxDmaIrqHandler(void);
+#endif /* USART2_ENABLE */
+
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+RAMFUNC static void Usart3_RxDmaIrqHandler(void);
+#endif /* USART3_ENABLE */
+
+#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+RAMFUNC static void Uart4_RxDmaIrqHandler(void);
+#endif /* UART4_ENABLE */
+
+#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+RAMFUNC static void Uart5_RxDmaIrqHandler(void);
+#endif /* UART5_ENABLE */
+
+#if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+RAMFUNC static void Lpuart1_RxDmaIrqHandler(void);
 #endif /* LPUART1_ENABLE */
 
+#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+RAMFUNC static void Usart1_TxDmaIrqHandler(void);
+#endif /* USART1_ENABLE */
+
+#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+RAMFUNC static void Usart2_TxDmaIrqHandler(void);
+#endif /* USART2_ENABLE */
+
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+RAMFUNC static void Usart3_TxDmaIrqHandler(void);
+#endif /* USART3_ENABLE */
+
+#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+RAMFUNC static void Uart4_TxDmaIrqHandler(void);
+#endif /* UART4_ENABLE */
+
+#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+RAMFUNC static void Uart5_TxDmaIrqHandler(void);
+#endif /* UART5_ENABLE */
+
+#if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+RAMFUNC static void Lpuart1_TxDmaIrqHandler(void);
+#endif /* LPUART1_ENABLE */
 
 /* -------------------------- Private function definitions ------------------------- */
 
@@ -169,6 +318,176 @@ static IRQn_Type Uart_InstanceToIrqNum(const USART_TypeDef* Uart)
     else                      { return INVALID_IRQn; }
 }
 
+/**
+ * @brief Determine the position of the kernel clock selection field in RCC_CCIPR
+ *        matching the given UART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return Bit position of the selection field.
+ */
+static U8 Uart_InstanceToClockSelectPos(const USART_TypeDef* Uart)
+{
+    if      (Uart == USART1)  { return RCC_CCIPR_USART1SEL_Pos;  }
+    else if (Uart == USART2)  { return RCC_CCIPR_USART2SEL_Pos;  }
+    else if (Uart == USART3)  { return RCC_CCIPR_USART3SEL_Pos;  }
+    else if (Uart == UART4)   { return RCC_CCIPR_UART4SEL_Pos;   }
+    else if (Uart == UART5)   { return RCC_CCIPR_UART5SEL_Pos;   }
+    else                      { return RCC_CCIPR_LPUART1SEL_Pos; }
+}
+
+/**
+ * @brief Determine the EXTI line carrying the wake-up from Stop mode event of
+ *        the given UART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return Interrupt mask bit of the EXTI line.
+ */
+static U32 Uart_InstanceToExtiLine(const USART_TypeDef* Uart)
+{
+    if      (Uart == USART1)  { return EXTI_IMR1_IM25; }
+    else if (Uart == USART2)  { return EXTI_IMR1_IM26; }
+    else if (Uart == USART3)  { return EXTI_IMR1_IM27; }
+    else if (Uart == UART4)   { return EXTI_IMR1_IM28; }
+    else if (Uart == UART5)   { return EXTI_IMR1_IM29; }
+    else                      { return EXTI_IMR1_IM31; }
+}
+
+/**
+ * @brief Determine the interrupt handler to install for the given
+ *        USART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return Matching interrupt handler, NULL if the instance is not enabled.
+ */
+static Irq_HandlerType Uart_InstanceToIrqHandler(const USART_TypeDef* Uart)
+{
+    #if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+    if (Uart == USART1) { return Usart1_IrqHandler; }
+    #endif /* USART1_ENABLE */
+
+    #if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+    if (Uart == USART2) { return Usart2_IrqHandler; }
+    #endif /* USART2_ENABLE */
+
+    #if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+    if (Uart == USART3) { return Usart3_IrqHandler; }
+    #endif /* USART3_ENABLE */
+
+    #if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+    if (Uart == UART4) { return Uart4_IrqHandler; }
+    #endif /* UART4_ENABLE */
+
+    #if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+    if (Uart == UART5) { return Uart5_IrqHandler; }
+    #endif /* UART5_ENABLE */
+
+    #if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+    if (Uart == LPUART1) { return Lpuart1_IrqHandler; }
+    #endif /* LPUART1_ENABLE */
+
+    UNUSED(Uart);
+    return (Irq_HandlerType)NULL;
+}
+
+/**
+ * @brief Determine the DMA channel interrupt handler to install for
+ *        reception on the given USART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return Matching interrupt handler, NULL if the instance is not enabled.
+ */
+static Irq_HandlerType Uart_InstanceToRxDmaIrqHandler(const USART_TypeDef* Uart)
+{
+    #if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+    if (Uart == USART1) { return Usart1_RxDmaIrqHandler; }
+    #endif /* USART1_ENABLE */
+
+    #if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+    if (Uart == USART2) { return Usart2_RxDmaIrqHandler; }
+    #endif /* USART2_ENABLE */
+
+    #if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+    if (Uart == USART3) { return Usart3_RxDmaIrqHandler; }
+    #endif /* USART3_ENABLE */
+
+    #if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+    if (Uart == UART4) { return Uart4_RxDmaIrqHandler; }
+    #endif /* UART4_ENABLE */
+
+    #if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+    if (Uart == UART5) { return Uart5_RxDmaIrqHandler; }
+    #endif /* UART5_ENABLE */
+
+    #if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+    if (Uart == LPUART1) { return Lpuart1_RxDmaIrqHandler; }
+    #endif /* LPUART1_ENABLE */
+
+    UNUSED(Uart);
+    return (Irq_HandlerType)NULL;
+}
+
+/**
+ * @brief Determine the DMA channel interrupt handler to install for
+ *        transmission on the given USART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return Matching interrupt handler, NULL if the instance is not enabled.
+ */
+static Irq_HandlerType Uart_InstanceToTxDmaIrqHandler(const USART_TypeDef* Uart)
+{
+    #if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+    if (Uart == USART1) { return Usart1_TxDmaIrqHandler; }
+    #endif /* USART1_ENABLE */
+
+    #if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+    if (Uart == USART2) { return Usart2_TxDmaIrqHandler; }
+    #endif /* USART2_ENABLE */
+
+    #if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+    if (Uart == USART3) { return Usart3_TxDmaIrqHandler; }
+    #endif /* USART3_ENABLE */
+
+    #if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+    if (Uart == UART4) { return Uart4_TxDmaIrqHandler; }
+    #endif /* UART4_ENABLE */
+
+    #if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+    if (Uart == UART5) { return Uart5_TxDmaIrqHandler; }
+    #endif /* UART5_ENABLE */
+
+    #if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+    if (Uart == LPUART1) { return Lpuart1_TxDmaIrqHandler; }
+    #endif /* LPUART1_ENABLE */
+
+    UNUSED(Uart);
+    return (Irq_HandlerType)NULL;
+}
+
+/**
+ * @brief Determine the DMA request for reception of the given USART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return DMA request.
+ */
+static Dma_RequestEnum Uart_InstanceToRxDmaRequest(const USART_TypeDef* Uart)
+{
+    if      (Uart == USART1)  { return DMA_REQUEST_USART1_RX;  }
+    else if (Uart == USART2)  { return DMA_REQUEST_USART2_RX;  }
+    else if (Uart == USART3)  { return DMA_REQUEST_USART3_RX;  }
+    else if (Uart == UART4)   { return DMA_REQUEST_UART4_RX;   }
+    else if (Uart == UART5)   { return DMA_REQUEST_UART5_RX;   }
+    else                      { return DMA_REQUEST_LPUART1_RX; }
+}
+
+/**
+ * @brief Determine the DMA request for transmission of the given USART peripheral instance.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return DMA request.
+ */
+static Dma_RequestEnum Uart_InstanceToTxDmaRequest(const USART_TypeDef* Uart)
+{
+    if      (Uart == USART1)  { return DMA_REQUEST_USART1_TX;  }
+    else if (Uart == USART2)  { return DMA_REQUEST_USART2_TX;  }
+    else if (Uart == USART3)  { return DMA_REQUEST_USART3_TX;  }
+    else if (Uart == UART4)   { return DMA_REQUEST_UART4_TX;   }
+    else if (Uart == UART5)   { return DMA_REQUEST_UART5_TX;   }
+    else                      { return DMA_REQUEST_LPUART1_TX; }
+}
+
 /**
  * @brief Determine the local handle to use for the given
  *        USART peripheral instance.
@@ -177,7 +496,7 @@ static IRQn_Type Uart_InstanceToIrqNum(const USART_TypeDef* Uart)
  */
 static Uart_HandleType Uart_InstanceToHandle(const USART_TypeDef* Uart)
 {
-    #if defined(USART1_ENABLE) && (USART1_ENALBE == 1U)
+    #if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
     if (Uart == USART1) { return &Usart1Handle; }
     #endif /* USART1_ENABLE */
 
@@ -185,9 +504,9 @@ static Uart_HandleType Uart_InstanceToHandle(const USART_TypeDef* Uart)
     if (Uart == USART2) { return &Usart2Handle; }
     #endif /* USART2_ENABLE */
 
-    #if defined(USART3_ENABLE) && (USART3_ENALBE == 1U)
+    #if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
     if (Uart == USART3) { return &Usart3Handle; }
-    #endif /* USART#_ENABLE */
+    #endif /* USART3_ENABLE */
 
     #if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
     if (Uart == UART4) { return &Uart4Handle; }
@@ -266,20 +585,109 @@ static inline void Uart_SetStopBits(USART_TypeDef* Uart, Uart_StopBitsEnum StopB
 }
 
 /**
- * @brief Configure the baud rate for the given UART peripheral.
+ * @brief Divide with rounding to nearest, scaling the numerator by 2^Shift
+ *        without the need for 64-bit arithmetic.
+ * @param Numerator Numerator.
+ * @param Denominator Denominator, must be below 2^31.
+ * @param Shift Number of bits to scale the numerator by.
+ * @return Rounded quotient.
+ */
+static U32 Uart_DivRound(U32 Numerator, U32 Denominator, U8 Shift)
+{
+    U32 Quotient = Numerator / Denominator;
+    U32 Remainder = Numerator % Denominator;
+    for (U8 i = 0; i < Shift; i++)
+    {
+        Quotient <<= 1;
+        Remainder <<= 1;
+        if (Remainder >= Denominator)
+        {
+            Quotient |= 1U;
+            Remainder -= Denominator;
+        }
+    }
+    return Quotient + ((Remainder >= (Denominator - Remainder)) ? 1U : 0U);
+}
+
+/**
+ * @brief Get the frequency of the kernel clock currently selected for the given UART peripheral.
+ * @param Uart Pointer to USART peripheral structure.
+ * @return Kernel clock frequency in Hz.
+ */
+static U32 Uart_GetKernelClockFreq(const USART_TypeDef* Uart)
+{
+    U32 Rv;
+    switch ((Uart_ClockSourceEnum)((RCC->CCIPR >> Uart_InstanceToClockSelectPos(Uart)) & 0x3UL))
+    {
+        case UART_CLOCK_SOURCE_SYSCLK: { Rv = ClkCtrl_GetNodeFreq(CLK_NODE_SYSCLK); break; }
+        case UART_CLOCK_SOURCE_HSI:    { Rv = HSI_FREQ_Hz; break; }
+        case UART_CLOCK_SOURCE_LSE:    { Rv = LSE_Freq_Hz; break; }
+        default:
+        {
+            Rv = (Uart == USART1) ? ClkCtrl_GetNodeFreq(CLK_NODE_PCLK2) : ClkCtrl_GetNodeFreq(CLK_NODE_PCLK1);
+            break;
+        }
+    }
+    return Rv;
+}
+
+/**
+ * @brief Select the kernel clock source for the given UART peripheral, starting the
+ *        HSI or LSE oscillator if selected.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param ClockSource Kernel clock source.
+ */
+static inline void Uart_SetClockSource(const USART_TypeDef* Uart, Uart_ClockSourceEnum ClockSource)
+{
+    if ( (ClockSource == UART_CLOCK_SOURCE_HSI) && !ClkCtrl_HsiEnabled() ) { ClkCtrl_HsiEnable(True); }
+    if ( (ClockSource == UART_CLOCK_SOURCE_LSE) && !ClkCtrl_LseEnabled() ) { ClkCtrl_LseEnable(True); }
+
+    const U8 Pos = Uart_InstanceToClockSelectPos(Uart);
+    RCC->CCIPR = (RCC->CCIPR & ~(0x3UL << Pos)) | ((U32)ClockSource << Pos);
+}
+
+/**
+ * @brief Calculate the baud rate register value for the given UART peripheral.
  * @param Uart Pointer to USART peripheral structure.
  * @param BaudRate The desired baud rate.
- * @param Oversampling The oversampling setting for the given UART peripheral.
+ * @param Oversampling The oversampling setting for the given UART peripheral, not used by LPUART1.
+ * @param Brr Calculated baud rate register value.
+ * @param BaudError_ppm Deviation of the resulting from the desired baud rate in parts per million.
+ * @return RC_OK = success, RC_ERROR = baud rate out of range for the kernel clock.
  */
-static inline void Uart_SetBaudRate(USART_TypeDef* Uart, U32 BaudRate, Uart_OversamplingEnum Oversampling)
+static ReturnCodeEnum Uart_CalcBaudRate(const USART_TypeDef* Uart, U32 BaudRate, Uart_OversamplingEnum Oversampling,
+                                        U32* Brr, S32* BaudError_ppm)
 {
+    const U32 KernelFreq_Hz = Uart_GetKernelClockFreq(Uart);
+
     /**
-     * @note For now it is assumed that the clock source to the USART peripheral clock domains
-     *       remain at their reset values (PCLK1, PCLK2).
+     * The divider is kernel clock / baud scaled by 256 for LPUART1, by 2 with 8x oversampling
+     * (USARTDIV) & unscaled with 16x oversampling.
      */
-    const U32 PclkFreq_Hz = (Uart == USART1) ? ClkCtrl_GetNodeFreq(CLK_NODE_PCLK2) : ClkCtrl_GetNodeFreq(CLK_NODE_PCLK1);
-    const U32 ClkDiv = (Oversampling == UART_OVERSAMPLING_16) ? (U32)(PclkFreq_Hz / BaudRate) : (U32)((PclkFreq_Hz << 1) / BaudRate);
-    if (ClkDiv <= UINT16_MAX) { Uart->BRR = (U16)ClkDiv; }
+    U8 Shift = 0U;
+    U32 MinDiv = 16U;
+    U32 MaxDiv = UINT16_MAX;
+    if (Uart == LPUART1)
+    {
+        Shift = 8U;
+        MinDiv = 0x300U;
+        MaxDiv = 0xFFFFFU;
+    }
+    else if (Oversampling == UART_OVERSAMPLING_8)
+    {
+        Shift = 1U;
+    }
+
+    if ( (BaudRate == 0U) || ((KernelFreq_Hz / BaudRate) > (MaxDiv >> Shift)) ) { return RC_ERROR; }
+    const U32 Div = Uart_DivRound(KernelFreq_Hz, BaudRate, Shift);
+    if ( (Div < MinDiv) || (Div > MaxDiv) ) { return RC_ERROR; }
+
+    /* With 8x oversampling BRR[2:0] holds USARTDIV[3:0] shifted right by one, BRR[3] is kept clear. */
+    *Brr = (Shift == 1U) ? ((Div & 0xFFF0U) | ((Div & 0xFU) >> 1)) : Div;
+
+    const F32 ActualBaudRate = ((F32)KernelFreq_Hz * (F32)(1UL << Shift)) / (F32)Div;
+    *BaudError_ppm = (S32)(((ActualBaudRate - (F32)BaudRate) / (F32)BaudRate) * 1.0e6f);
+    return RC_OK;
 }
 
 /**
@@ -331,6 +739,116 @@ static inline void Uart_RxInterruptDisable(USART_TypeDef* Uart)
     Uart->CR1 &= ~USART_CR1_RXNEIE;
 }
 
+/**
+ * @brief Configure hardware flow control & the RTS/CTS pins for the given UART peripheral.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param Config Pointer to configuration structure.
+ */
+static inline void Uart_SetFlowControl(USART_TypeDef* Uart, const Uart_ConfigType* Config)
+{
+    const Pin_AlternateFunctionEnum AltFunc = Uart_InstanceToAltFunc(Uart);
+    Uart->CR3 &= ~(USART_CR3_RTSE | USART_CR3_CTSE);
+    if (Config->FlowControl & UART_FLOW_CONTROL_RTS)
+    {
+        Pin_SetMode(Config->RtsPin, PIN_MODE_AF);
+        Pin_SetAltFunc(Config->RtsPin, AltFunc);
+        Uart->CR3 |= USART_CR3_RTSE;
+    }
+    if (Config->FlowControl & UART_FLOW_CONTROL_CTS)
+    {
+        Pin_SetMode(Config->CtsPin, PIN_MODE_AF);
+        Pin_SetAltFunc(Config->CtsPin, AltFunc);
+        Uart->CR3 |= USART_CR3_CTSE;
+    }
+}
+
+/**
+ * @brief Configure the RS-485 driver enable output & its pin for the given UART peripheral.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param Config Pointer to configuration structure.
+ */
+static inline void Uart_SetDriverEnable(USART_TypeDef* Uart, const Uart_ConfigType* Config)
+{
+    Uart->CR3 &= ~(USART_CR3_DEM | USART_CR3_DEP);
+    Uart->CR1 &= ~(USART_CR1_DEAT | USART_CR1_DEDT);
+    if (Config->DriverEnable == UART_DRIVER_ENABLE_NONE) { return; }
+
+    Pin_SetMode(Config->DePin, PIN_MODE_AF);
+    Pin_SetAltFunc(Config->DePin, Uart_InstanceToAltFunc(Uart));
+
+    const U32 AssertionTime = (Config->DeAssertionTime < UART_DE_TIME_MAX) ? Config->DeAssertionTime : UART_DE_TIME_MAX;
+    const U32 DeassertionTime = (Config->DeDeassertionTime < UART_DE_TIME_MAX) ? Config->DeDeassertionTime : UART_DE_TIME_MAX;
+    Uart->CR1 |= ( (AssertionTime << USART_CR1_DEAT_Pos) | (DeassertionTime << USART_CR1_DEDT_Pos) );
+
+    /* The driver enable output takes over the RTS pin. */
+    Uart->CR3 &= ~USART_CR3_RTSE;
+    if (Config->DriverEnable == UART_DRIVER_ENABLE_ACTIVE_LOW) { Uart->CR3 |= USART_CR3_DEP; }
+    Uart->CR3 |= USART_CR3_DEM;
+}
+
+/**
+ * @brief Set the node address matched by address mark wake-up & address match wake-up
+ *        from Stop mode for the given UART peripheral.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param Config Pointer to configuration structure.
+ */
+static inline void Uart_SetNodeAddress(USART_TypeDef* Uart, const Uart_ConfigType* Config)
+{
+    const U32 AddressMask = (Config->AddressLength == UART_ADDRESS_7BIT) ? 0x7FU : 0x0FU;
+    Uart->CR2 &= ~(USART_CR2_ADD | USART_CR2_ADDM7);
+    Uart->CR2 |= ((Config->NodeAddress & AddressMask) << USART_CR2_ADD_Pos);
+    if (Config->AddressLength == UART_ADDRESS_7BIT) { Uart->CR2 |= USART_CR2_ADDM7; }
+}
+
+/**
+ * @brief Configure multiprocessor mute mode & the node address for the given UART peripheral.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param Config Pointer to configuration structure.
+ */
+static inline void Uart_SetMuteMode(USART_TypeDef* Uart, const Uart_ConfigType* Config)
+{
+    Uart->CR1 &= ~(USART_CR1_MME | USART_CR1_WAKE);
+    if (Config->MuteMode == UART_MUTE_MODE_NONE) { return; }
+
+    if (Config->MuteMode == UART_MUTE_MODE_ADDRESS_MARK)
+    {
+        Uart_SetNodeAddress(Uart, Config);
+        Uart->CR1 |= USART_CR1_WAKE;
+    }
+    Uart->CR1 |= USART_CR1_MME;
+}
+
+/**
+ * @brief Configure the wake-up from Stop mode event for the given UART peripheral.
+ *        The peripheral must be disabled.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param Config Pointer to configuration structure.
+ */
+static inline void Uart_SetStopWakeup(USART_TypeDef* Uart, const Uart_ConfigType* Config)
+{
+    Uart->CR1 &= ~USART_CR1_UESM;
+    Uart->CR3 &= ~(USART_CR3_WUS | USART_CR3_WUFIE);
+    if (Config->StopWakeup == UART_STOP_WAKEUP_NONE) { return; }
+
+    U32 Wus;
+    switch (Config->StopWakeup)
+    {
+        case UART_STOP_WAKEUP_START_BIT: { Wus = USART_CR3_WUS_1; break; }
+        case UART_STOP_WAKEUP_RXNE:      { Wus = USART_CR3_WUS; break; }
+        default:
+        {
+            Wus = 0U;
+            Uart_SetNodeAddress(Uart, Config);
+            break;
+        }
+    }
+    Uart->CR3 |= (Wus | USART_CR3_WUFIE);
+    Uart->CR1 |= USART_CR1_UESM;
+
+    /* The wake-up event reaches the core through the EXTI */
+    EXTI->IMR1 |= Uart_InstanceToExtiLine(Uart);
+}
+
 /**
  * @brief Enable DMA transmission mode for the given UART peripheral.
  * @param Uart Pointer to USART peripheral structure.
@@ -376,26 +894,295 @@ static inline void Uart_ClearTxCompleteFlag(USART_TypeDef* Uart)
     Uart->ICR |= USART_ICR_TCCF;
 }
 
-/* -------------------------- Public function definitions -------------------------- */
-
-void Uart_TxEnable(Uart_HandleType Uart)
+/**
+ * @brief Enable the idle line detection interrupt for the given UART peripheral.
+ * @param Uart Pointer to USART peripheral structure.
+ */
+static inline void Uart_IdleInterruptEnable(USART_TypeDef* Uart)
 {
-    Uart->Instance->CR1 |= USART_CR1_TE;
+    Uart->ICR = USART_ICR_IDLECF;
+    Uart->CR1 |= USART_CR1_IDLEIE;
 }
 
-void Uart_TxDisable(Uart_HandleType Uart)
+/**
+ * @brief Set up & start circular DMA reception into the input buffer of the given handle.
+ * @param Uart UART peripheral handle.
+ * @return True = reception started, False = no DMA channel available.
+ */
+static Bool Uart_RxDmaStart(struct Uart_OpaqueHandleType* Uart)
 {
-    Uart->Instance->CR1 &= ~USART_CR1_TE;
-}
+    Dma_Init();
+    if (Uart->RxDma != NULL)
+    {
+        (void)Dma_ReleaseChannel(Uart->RxDma, Uart);
+        Uart->RxDma = NULL;
+    }
 
-void Uart_RxEnable(Uart_HandleType Uart)
-{
-    Uart->Instance->CR1 |= USART_CR1_RE;
-}
+    U8 Selection;
+    const Dma_HandleType RxDma = Dma_ClaimRequestChannel(Uart_InstanceToRxDmaRequest(Uart->Instance), Uart, &Selection);
+    if (RxDma == NULL) { return False; }
 
-void Uart_RxDisable(Uart_HandleType Uart)
-{
-    Uart->Instance->CR1 &= ~USART_CR1_RE;
+    const Dma_ConfigType DmaCfg =
+    {
+        .Direction = DMA_TRANSFER_DIR_READ_FROM_PERIPHERAL,
+        .Priority = DMA_CHANNEL_PRIO_HIGH,
+        .PeripheralSize = DMA_TRANSFER_SIZE_8BIT,
+        .MemorySize = DMA_TRANSFER_SIZE_8BIT,
+        .PeripheralIncrement = False,
+        .MemoryIncrement = True,
+        .Circular = True,
+        .MemToMem = False,
+        .Request = Selection,
+        .TransferCompleteInterrupt = True,
+        .HalfTransferInterrupt = True,
+        .TransferErrorInterrupt = True
+    };
+
+    Dma_Configure(RxDma, &DmaCfg);
+    Dma_SetTransfer(RxDma, &Uart->Instance->RDR, Uart->RxFifo->Buffer, Uart->RxFifo->Length);
+    Uart->RxDma = RxDma;
+    Uart->RxDmaPosition = 0U;
+
+    const IRQn_Type Irq = Dma_GetIrqNum(RxDma);
+    (void)Irq_Register(Irq, Uart_InstanceToRxDmaIrqHandler(Uart->Instance));
+    NVIC_SetPriority(Irq, DMA_IRQ_PRIO);
+    NVIC_EnableIRQ(Irq);
+
+    Dma_ChannelEnable(RxDma);
+    Uart_DmaRxEnable(Uart->Instance);
+    return True;
+}
+
+/**
+ * @brief Set up the DMA channel used for transmission from the output buffer of the given handle.
+ * @param Uart UART peripheral handle.
+ * @return True = channel set up, False = no DMA channel available.
+ */
+static Bool Uart_TxDmaSetup(struct Uart_OpaqueHandleType* Uart)
+{
+    Dma_Init();
+    if (Uart->TxDma != NULL)
+    {
+        (void)Dma_ReleaseChannel(Uart->TxDma, Uart);
+        Uart->TxDma = NULL;
+    }
+
+    U8 Selection;
+    const Dma_HandleType TxDma = Dma_ClaimRequestChannel(Uart_InstanceToTxDmaRequest(Uart->Instance), Uart, &Selection);
+    if (TxDma == NULL) { return False; }
+
+    const Dma_ConfigType DmaCfg =
+    {
+        .Direction = DMA_TRANSFER_DIR_READ_FROM_MEMORY,
+        .Priority = DMA_CHANNEL_PRIO_MEDIUM,
+        .PeripheralSize = DMA_TRANSFER_SIZE_8BIT,
+        .MemorySize = DMA_TRANSFER_SIZE_8BIT,
+        .PeripheralIncrement = False,
+        .MemoryIncrement = True,
+        .Circular = False,
+        .MemToMem = False,
+        .Request = Selection,
+        .TransferCompleteInterrupt = True,
+        .HalfTransferInterrupt = False,
+        .TransferErrorInterrupt = True
+    };
+
+    Dma_Configure(TxDma, &DmaCfg);
+    Uart->TxDma = TxDma;
+    Uart->TxDmaCount = 0U;
+
+    const IRQn_Type Irq = Dma_GetIrqNum(TxDma);
+    (void)Irq_Register(Irq, Uart_InstanceToTxDmaIrqHandler(Uart->Instance));
+    NVIC_SetPriority(Irq, DMA_IRQ_PRIO);
+    NVIC_EnableIRQ(Irq);
+
+    Uart_DmaTxEnable(Uart->Instance);
+    return True;
+}
+
+/**
+ * @brief Stamp the publication of received data with the cycle counter.
+ * @param Uart UART peripheral handle.
+ */
+__attribute__((always_inline))
+static inline void Uart_RxTimestamp(Uart_HandleType Uart)
+{
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    Uart->RxTimestamp = ReadCycleCounter();
+#else
+    UNUSED(Uart);
+#endif /* UART_TIMESTAMP_ENABLE */
+}
+
+/**
+ * @brief Arm the transmission complete interrupt once the output buffer is drained,
+ *        it fires when the last byte has left the shift register.
+ * @param Uart UART peripheral handle.
+ */
+__attribute__((always_inline))
+static inline void Uart_TxTimestampArm(Uart_HandleType Uart)
+{
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+    Uart->Instance->CR1 |= USART_CR1_TCIE;
+#else
+    UNUSED(Uart);
+#endif /* UART_TIMESTAMP_ENABLE */
+}
+
+/**
+ * @brief Start transmission of the data queued in the output buffer of the given handle.
+ *        A DMA transfer covers the largest contiguous span of the buffer, small amounts
+ *        of data are sent in interrupt mode. The first byte is then written by the TXE
+ *        interrupt, after a DMA transfer the data register may still hold its last byte.
+ * @param Uart UART peripheral handle.
+ * @note Output buffer must not be empty. Called from interrupt context or within a critical section.
+ */
+__attribute__((always_inline))
+static inline void Uart_TxStart(Uart_HandleType Uart)
+{
+    if ( (Uart->TxDma != NULL) && (Fifo_GetNofItems(Uart->TxFifo) >= UART_DMA_TX_THRESHOLD) )
+    {
+        const U16 Count = Fifo_GetNofContiguousItems(Uart->TxFifo);
+        Uart->TxDmaCount = Count;
+        Dma_SetTransfer(Uart->TxDma, &Uart->Instance->TDR, &Uart->TxFifo->Buffer[Uart->TxFifo->Tail], Count);
+        Dma_ChannelEnable(Uart->TxDma);
+    }
+    else
+    {
+        Uart_TxInterruptEnable(Uart->Instance);
+    }
+    Uart->TxBusy = True;
+}
+
+/**
+ * @brief Resume interrupt mode reception stalled by RTS flow control once
+ *        there is room in the input buffer.
+ * @param Uart UART peripheral handle.
+ * @note Call within a critical section.
+ */
+static inline void Uart_RxResume(Uart_HandleType Uart)
+{
+    if ( Uart->RtsFlowControl && (Uart->RxDma == NULL) && !Fifo_Full(Uart->RxFifo) )
+    {
+        Uart_RxInterruptEnable(Uart->Instance);
+    }
+}
+
+/**
+ * @brief Publish data written into the input buffer by DMA since the last call.
+ * @param Uart UART peripheral handle.
+ * @note Called from interrupt context or within a critical section.
+ */
+__attribute__((always_inline))
+static inline void Uart_RxDmaPublish(Uart_HandleType Uart)
+{
+    const U16 Position = (U16)((Uart->RxFifo->Length - Dma_GetTransferCnt(Uart->RxDma)) & Uart->RxFifo->Mask);
+    const U16 Count = (U16)((Position - Uart->RxDmaPosition) & Uart->RxFifo->Mask);
+    Uart->RxDmaPosition = Position;
+    if (Count == 0U) { return; }
+    Uart->ErrorCounts[UART_ERROR_DROP] += Fifo_CommitWrite(Uart->RxFifo, Count);
+    Uart_RxTimestamp(Uart);
+}
+
+/**
+ * @brief Wake the thread blocked in Uart_ReadTimeout(), if any, once enough data is available.
+ * @param Uart UART peripheral handle.
+ * @param Force Wake regardless of the amount of data available.
+ * @note Only use inside of interrupt context.
+ */
+__attribute__((always_inline))
+static inline void Uart_RxWakeCheck(Uart_HandleType Uart, Bool Force)
+{
+#if defined(UART_RTOS_ENABLE) && (UART_RTOS_ENABLE == 1U)
+    if ( (Uart->RxWaiter != NULL) && (Force || (Fifo_GetNofItems(Uart->RxFifo) >= Uart->RxThreshold)) )
+    {
+        Osal_NotifyFromISR(Uart->RxWaiter);
+        Uart->RxWaiter = NULL;
+    }
+#else
+    UNUSED(Uart);
+    UNUSED(Force);
+#endif /* UART_RTOS_ENABLE */
+}
+
+/**
+ * @brief Wake the thread blocked in Uart_WriteTimeout(), if any, once enough room is available.
+ * @param Uart UART peripheral handle.
+ * @param Force Wake regardless of the amount of room available.
+ * @note Only use inside of interrupt context.
+ */
+__attribute__((always_inline))
+static inline void Uart_TxWakeCheck(Uart_HandleType Uart, Bool Force)
+{
+#if defined(UART_RTOS_ENABLE) && (UART_RTOS_ENABLE == 1U)
+    if ( (Uart->TxWaiter != NULL) && (Force || (Fifo_GetNofAvailable(Uart->TxFifo) >= Uart->TxThreshold)) )
+    {
+        Osal_NotifyFromISR(Uart->TxWaiter);
+        Uart->TxWaiter = NULL;
+    }
+#else
+    UNUSED(Uart);
+    UNUSED(Force);
+#endif /* UART_RTOS_ENABLE */
+}
+
+/**
+ * @brief Write the given baud rate register value, BRR is only writable while the
+ *        peripheral is disabled.
+ * @param Uart Pointer to USART peripheral structure.
+ * @param Brr Baud rate register value.
+ */
+__attribute__((always_inline))
+static inline void Uart_WriteBrr(USART_TypeDef* Uart, U32 Brr)
+{
+    const U32 Enabled = Uart->CR1 & USART_CR1_UE;
+    Uart->CR1 &= ~USART_CR1_UE;
+    Uart->BRR = Brr;
+    Uart->CR1 |= Enabled;
+}
+
+/**
+ * @brief Apply a pending baud rate switch once the last queued byte has left the shift
+ *        register, otherwise keep the transmission complete interrupt armed.
+ * @param Uart UART peripheral handle.
+ * @note Only use inside of interrupt context.
+ */
+__attribute__((always_inline))
+static inline void Uart_BaudRateSwitchCheck(Uart_HandleType Uart)
+{
+    if (!Uart->BaudRatePending) { return; }
+
+    USART_TypeDef* const Instance = Uart->Instance;
+    if ( Uart->TxBusy || !(Instance->ISR & USART_ISR_TC) )
+    {
+        Instance->CR1 |= USART_CR1_TCIE;
+        return;
+    }
+    Uart_WriteBrr(Instance, Uart->PendingBrr);
+    Uart->BaudRatePending = False;
+    Uart_TxWakeCheck(Uart, True);
+}
+
+/* -------------------------- Public function definitions -------------------------- */
+
+void Uart_TxEnable(Uart_HandleType Uart)
+{
+    Uart->Instance->CR1 |= USART_CR1_TE;
+}
+
+void Uart_TxDisable(Uart_HandleType Uart)
+{
+    Uart->Instance->CR1 &= ~USART_CR1_TE;
+}
+
+void Uart_RxEnable(Uart_HandleType Uart)
+{
+    Uart->Instance->CR1 |= USART_CR1_RE;
+}
+
+void Uart_RxDisable(Uart_HandleType Uart)
+{
+    Uart->Instance->CR1 &= ~USART_CR1_RE;
 }
 
 void Uart_Enable(Uart_HandleType Uart)
@@ -408,6 +1195,16 @@ void Uart_Disable(Uart_HandleType Uart)
     Uart->Instance->CR1 &= ~USART_CR1_UE;
 }
 
+void Uart_EnterMuteMode(Uart_HandleType Uart)
+{
+    Uart->Instance->RQR = USART_RQR_MMRQ;
+}
+
+Bool Uart_IsMuted(Uart_HandleType Uart)
+{
+    return ((Uart->Instance->ISR & USART_ISR_RWU) != 0U);
+}
+
 void Uart_CharacterMatchInterruptEnable(Uart_HandleType Uart, U8 MatchByte)
 {
     /* Clear interrupt flag, configure match byte and then enable interrupt. */
@@ -424,6 +1221,13 @@ void Uart_CharacterMatchInterruptDisable(Uart_HandleType Uart)
 
 Uart_HandleType Uart_Init(USART_TypeDef* Uart, const Uart_ConfigType* Config)
 {
+    /* Caller owned buffers must suit the fifo wrap-around logic */
+    if ( ((Config->TxBuffer != NULL) && !UART_BUFFER_SIZE_VALID(Config->TxBufferSize)) ||
+         ((Config->RxBuffer != NULL) && !UART_BUFFER_SIZE_VALID(Config->RxBufferSize)) )
+    {
+        return NULL;
+    }
+
     const Pin_AlternateFunctionEnum AltFunc = Uart_InstanceToAltFunc(Uart);
     Pin_SetMode(Config->TxPin, PIN_MODE_AF);
     Pin_SetMode(Config->RxPin, PIN_MODE_AF);
@@ -434,17 +1238,48 @@ Uart_HandleType Uart_Init(USART_TypeDef* Uart, const Uart_ConfigType* Config)
     Uart_SetStopBits(Uart, Config->StopBits);
     Uart_SetOversampling(Uart, Config->Oversampling);
     Uart_SetSamplingMethod(Uart, Config->SamplingMethod);
-    Uart_SetBaudRate(Uart, Config->BaudRate, Config->Oversampling);
+    Uart_SetFlowControl(Uart, Config);
+    Uart_SetDriverEnable(Uart, Config);
+    Uart_SetMuteMode(Uart, Config);
+    Uart_SetStopWakeup(Uart, Config);
+    Uart_SetClockSource(Uart, Config->ClockSource);
+    U32 Brr;
+    S32 BaudError_ppm;
+    if (Uart_CalcBaudRate(Uart, Config->BaudRate, Config->Oversampling, &Brr, &BaudError_ppm) == RC_OK)
+    {
+        Uart->BRR = Brr;
+    }
 
     /* Initialize Tx & Rx buffers */
     struct Uart_OpaqueHandleType* const TempHandle = Uart_InstanceToHandle(Uart);
     if (TempHandle == NULL) { return TempHandle; }
-    Fifo_Init(TempHandle->TxFifo, TempHandle->TxBuffer, UART_TX_BUFFER_SIZE);
-    Fifo_Init(TempHandle->RxFifo, TempHandle->RxBuffer, UART_RX_BUFFER_SIZE);
+    if (Config->TxBuffer != NULL) { Fifo_Init(TempHandle->TxFifo, Config->TxBuffer, Config->TxBufferSize); }
+    else                          { Fifo_Init(TempHandle->TxFifo, TempHandle->TxBuffer, TempHandle->TxBufferSize); }
+    if (Config->RxBuffer != NULL) { Fifo_Init(TempHandle->RxFifo, Config->RxBuffer, Config->RxBufferSize); }
+    else                          { Fifo_Init(TempHandle->RxFifo, TempHandle->RxBuffer, TempHandle->RxBufferSize); }
+    TempHandle->RtsFlowControl = ((Uart->CR3 & USART_CR3_RTSE) != 0U);
+
+    /* DMA reception publishes data on idle line, otherwise one interrupt per byte */
+    if ( (Config->RxMode == UART_TRANSFER_MODE_DMA) && Uart_RxDmaStart(TempHandle) )
+    {
+        Uart_RxInterruptDisable(Uart);
+        Uart_IdleInterruptEnable(Uart);
+    }
+    else
+    {
+        Uart_RxInterruptEnable(Uart);
+    }
 
-    /* NVIC configuration */
-    Uart_RxInterruptEnable(Uart);
+    if (Config->TxMode == UART_TRANSFER_MODE_DMA) { (void)Uart_TxDmaSetup(TempHandle); }
+
+    /* Line errors are counted & cleared by the interrupt handler */
+    for (U8 i = 0; i < UART_ERROR_ENUM_LIMIT; i++) { TempHandle->ErrorCounts[i] = 0U; }
+    Uart->CR3 |= USART_CR3_EIE;
+    if (Config->Parity != UART_PARITY_NONE) { Uart->CR1 |= USART_CR1_PEIE; }
+
+    /* Interrupt handler installation & NVIC configuration */
     const IRQn_Type Irq = Uart_InstanceToIrqNum(Uart);
+    (void)Irq_Register(Irq, Uart_InstanceToIrqHandler(Uart));
     NVIC_SetPriority(Irq, UART_IRQ_PRIO);
     NVIC_EnableIRQ(Irq);
     return TempHandle;
@@ -473,40 +1308,26 @@ Bool Uart_TransmitChar(Uart_HandleType Uart, Char Data)
     Fifo_WriteByte(Uart->TxFifo, (U8)Data);
     CRITICAL_SECTION_EXIT;
 
-    if (!Uart->TxBusy)
-    {
-        U8 TxData;
-        CRITICAL_SECTION_ENTER;
-        Fifo_ReadByte(Uart->TxFifo, &TxData);
-        CRITICAL_SECTION_EXIT;
-        Uart_TxInterruptEnable(Uart->Instance);
-        Uart->Instance->TDR = TxData;
-        Uart->TxBusy = True;
-    }
+    CRITICAL_SECTION_ENTER;
+    if (!Uart->TxBusy) { Uart_TxStart(Uart); }
+    CRITICAL_SECTION_EXIT;
     return True;
 }
 
-Bool Uart_TransmitString(Uart_HandleType Uart, const Char* Data, U8 Length)
+Bool Uart_TransmitString(Uart_HandleType Uart, const Char* Data, U16 Length)
 {
     if (Length > Fifo_GetNofAvailable(Uart->TxFifo)) { return False; }
 
-    for (U8 i = 0; i < Length; i++)
+    for (U16 i = 0; i < Length; i++)
     {
         CRITICAL_SECTION_ENTER;
         Fifo_WriteByte(Uart->TxFifo, (U8)Data[i]);
         CRITICAL_SECTION_EXIT;
     }
 
-    if (!Uart->TxBusy)
-    {
-        U8 TxData;
-        CRITICAL_SECTION_ENTER;
-        Fifo_ReadByte(Uart->TxFifo, &TxData);
-        CRITICAL_SECTION_EXIT;
-        Uart_TxInterruptEnable(Uart->Instance);
-        Uart->Instance->TDR = TxData;
-        Uart->TxBusy = True;
-    }
+    CRITICAL_SECTION_ENTER;
+    if (!Uart->TxBusy) { Uart_TxStart(Uart); }
+    CRITICAL_SECTION_EXIT;
     return True;
 }
 
@@ -516,300 +1337,576 @@ Bool Uart_RecieveChar(Uart_HandleType Uart, Char* RxData)
 
     CRITICAL_SECTION_ENTER;
     Fifo_ReadByte(Uart->RxFifo, (U8*)RxData);
+    Uart_RxResume(Uart);
     CRITICAL_SECTION_EXIT;
     return True;
 }
 
-Bool Uart_Recieve(Uart_HandleType Uart, U8* RxData, U8 Length)
+Bool Uart_Recieve(Uart_HandleType Uart, U8* RxData, U16 Length)
 {
     if (Fifo_GetNofItems(Uart->RxFifo) < Length) { return False; }
 
-    for (U8 i = 0; i < Length; i++)
+    for (U16 i = 0; i < Length; i++)
     {
         CRITICAL_SECTION_ENTER;
         Fifo_ReadByte(Uart->RxFifo, &RxData[i]);
         CRITICAL_SECTION_EXIT;
     }
+    CRITICAL_SECTION_ENTER;
+    Uart_RxResume(Uart);
+    CRITICAL_SECTION_EXIT;
     return True;
 }
 
-Bool Uart_Transmit(Uart_HandleType Uart, const U8* Data, U8 Length)
+Bool Uart_Transmit(Uart_HandleType Uart, const U8* Data, U16 Length)
 {
     if (Length > Fifo_GetNofAvailable(Uart->TxFifo)) { return False; }
 
-    for (U8 i = 0; i < Length; i++)
+    for (U16 i = 0; i < Length; i++)
     {
         CRITICAL_SECTION_ENTER;
         Fifo_WriteByte(Uart->TxFifo, Data[i]);
         CRITICAL_SECTION_EXIT;
     }
 
-    if (!Uart->TxBusy)
-    {
-        U8 TxData;
-        CRITICAL_SECTION_ENTER;
-        Fifo_ReadByte(Uart->TxFifo, &TxData);
-        CRITICAL_SECTION_EXIT;
-        Uart_TxInterruptEnable(Uart->Instance);
-        Uart->Instance->TDR = TxData;
-        Uart->TxBusy = True;
-    }
+    CRITICAL_SECTION_ENTER;
+    if (!Uart->TxBusy) { Uart_TxStart(Uart); }
+    CRITICAL_SECTION_EXIT;
     return True;
 }
 
 void Uart_RxBufferClear(Uart_HandleType Uart)
 {
     CRITICAL_SECTION_ENTER;
-    Fifo_Clear(Uart->RxFifo, False);
+    if (Uart->RxDma != NULL)
+    {
+        /* The fifo head has to keep tracking the DMA write position. */
+        Uart_RxDmaPublish(Uart);
+        Uart->RxFifo->Tail = Uart->RxFifo->Head;
+        Uart->RxFifo->NofItems = 0U;
+    }
+    else
+    {
+        Fifo_Clear(Uart->RxFifo, False);
+        Uart_RxResume(Uart);
+    }
     CRITICAL_SECTION_EXIT;
 }
 
-U8 Uart_GetNofInputBufferBytes(Uart_HandleType Uart)
+U16 Uart_GetNofInputBufferBytes(Uart_HandleType Uart)
 {
     return Uart->RxFifo->NofItems;
 }
 
-U8 Uart_GetNofOutputBufferBytes(Uart_HandleType Uart)
+U16 Uart_GetNofOutputBufferBytes(Uart_HandleType Uart)
 {
     return Uart->TxFifo->NofItems;
 }
 
-/* ------------------------------- Interrupt handlers ------------------------------ */
+ReturnCodeEnum Uart_CheckBaudRate(Uart_HandleType Uart, U32 BaudRate, S32* BaudError_ppm)
+{
+    const Uart_OversamplingEnum Oversampling = (Uart->Instance->CR1 & USART_CR1_OVER8) ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16;
+    U32 Brr;
+    S32 Error_ppm;
+    const ReturnCodeEnum RetVal = Uart_CalcBaudRate(Uart->Instance, BaudRate, Oversampling, &Brr, &Error_ppm);
+    if ( (RetVal == RC_OK) && (BaudError_ppm != NULL) ) { *BaudError_ppm = Error_ppm; }
+    return RetVal;
+}
 
-void Uart_InterruptHandler(Uart_HandleType Uart)
+ReturnCodeEnum Uart_SetBaudRate(Uart_HandleType Uart, U32 BaudRate, S32* BaudError_ppm)
 {
-    /**
-     * @todo Figure clean way to selec interrupt handler based on
-     *       UART config (DMA vs non-DMA etc.)
-     */
-    UNUSED(Uart);
+    USART_TypeDef* const Instance = Uart->Instance;
+    const Uart_OversamplingEnum Oversampling = (Instance->CR1 & USART_CR1_OVER8) ? UART_OVERSAMPLING_8 : UART_OVERSAMPLING_16;
+    U32 Brr;
+    S32 Error_ppm;
+    if (Uart_CalcBaudRate(Instance, BaudRate, Oversampling, &Brr, &Error_ppm) != RC_OK) { return RC_ERROR; }
+
+    /* Let queued data go out at the current baud rate, the switch then completes from the TC interrupt */
+    CRITICAL_SECTION_ENTER;
+    const U32 Cr1 = Instance->CR1;
+    if ( (Cr1 & USART_CR1_UE) && (Cr1 & USART_CR1_TE) && (Uart->TxBusy || !(Instance->ISR & USART_ISR_TC)) )
+    {
+        Uart->PendingBrr = Brr;
+        Uart->BaudRatePending = True;
+        Instance->CR1 |= USART_CR1_TCIE;
+    }
+    else
+    {
+        Uart_WriteBrr(Instance, Brr);
+        Uart->BaudRatePending = False;
+    }
+    CRITICAL_SECTION_EXIT;
+
+    if (BaudError_ppm != NULL) { *BaudError_ppm = Error_ppm; }
+    return RC_OK;
 }
 
-/**
- * @brief Interrupt handler for USART1.
- */
-#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
-void USART1_IRQHandler(void)
+Bool Uart_IsBaudRateSwitchPending(Uart_HandleType Uart)
 {
-    const U32 TempIsr = USART1->ISR;
+    return Uart->BaudRatePending;
+}
 
-    /* Interrupt triggered by data reception */
-    if (TempIsr & USART_ISR_RXNE)
+U32 Uart_GetErrorCount(Uart_HandleType Uart, Uart_ErrorEnum Error)
+{
+    if (Error >= UART_ERROR_ENUM_LIMIT) { return 0U; }
+    return Uart->ErrorCounts[Error];
+}
+
+void Uart_ClearErrorCounts(Uart_HandleType Uart)
+{
+    CRITICAL_SECTION_ENTER;
+    for (U8 i = 0; i < UART_ERROR_ENUM_LIMIT; i++) { Uart->ErrorCounts[i] = 0U; }
+    CRITICAL_SECTION_EXIT;
+}
+
+#if defined(UART_RTOS_ENABLE) && (UART_RTOS_ENABLE == 1U)
+U16 Uart_ReadTimeout(Uart_HandleType Uart, U8* RxData, U16 Length, U32 Timeout_ms)
+{
+    /* A threshold beyond the buffer size is never reached. */
+    const U16 Threshold = (Length < Uart->RxFifo->Length) ? Length : Uart->RxFifo->Length;
+
+    Osal_NotifyClear();
+    CRITICAL_SECTION_ENTER;
+    if (Uart->RxDma != NULL) { Uart_RxDmaPublish(Uart); }
+    const Bool MustWait = (Fifo_GetNofItems(Uart->RxFifo) < Threshold);
+    if (MustWait)
     {
-        if (!Fifo_Full(Usart1Handle.RxFifo))
-        {
-            const U8 RxData = (U8)(USART1->RDR & 0xFFUL);
-            Fifo_WriteByte(Usart1Handle.RxFifo, RxData);
-        }
+        Uart->RxThreshold = Threshold;
+        Uart->RxWaiter = Osal_GetCurrentThread();
     }
+    CRITICAL_SECTION_EXIT;
 
-    /* Interrupt triggered by data transmission */
-    if (TempIsr & USART_ISR_TXE)
+    if (MustWait)
     {
-        if (!Fifo_Empty(Usart1Handle.TxFifo))
-        {
-            U8 TxData;
-            Fifo_ReadByte(Usart1Handle.TxFifo, &TxData);
-            USART1->TDR = TxData;
-        }
-        else
-        {
-            Usart1Handle.TxBusy = False;
-            USART1->CR1 &= ~USART_CR1_TXEIE;
-        }
+        (void)Osal_NotifyWait(Timeout_ms);
+        CRITICAL_SECTION_ENTER;
+        Uart->RxWaiter = NULL;
+        if (Uart->RxDma != NULL) { Uart_RxDmaPublish(Uart); }
+        CRITICAL_SECTION_EXIT;
+    }
+
+    U16 NofRead = 0;
+    while ( (NofRead < Length) && !Fifo_Empty(Uart->RxFifo) )
+    {
+        CRITICAL_SECTION_ENTER;
+        Fifo_ReadByte(Uart->RxFifo, &RxData[NofRead]);
+        CRITICAL_SECTION_EXIT;
+        NofRead++;
     }
+    CRITICAL_SECTION_ENTER;
+    Uart_RxResume(Uart);
+    CRITICAL_SECTION_EXIT;
+    return NofRead;
 }
-#endif /* USART1_ENABLE */
 
-/**
- * @brief Interrupt handler for USART2.
- */
-#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
-void USART2_IRQHandler(void)
+Bool Uart_WriteTimeout(Uart_HandleType Uart, const U8* Data, U16 Length, U32 Timeout_ms)
 {
-    const U32 TempIsr = USART2->ISR;
+    if (Length > Uart->TxFifo->Length) { return False; }
 
-    /* Interrupt triggered by data reception */
-    if (TempIsr & USART_ISR_RXNE)
+    Osal_NotifyClear();
+    CRITICAL_SECTION_ENTER;
+    const Bool MustWait = (Fifo_GetNofAvailable(Uart->TxFifo) < Length);
+    if (MustWait)
     {
-        if (!Fifo_Full(Usart2Handle.RxFifo))
-        {
-            const U8 RxData = (U8)(USART2->RDR & 0xFFUL);
-            Fifo_WriteByte(Usart2Handle.RxFifo, RxData);
-        }
+        Uart->TxThreshold = Length;
+        Uart->TxWaiter = Osal_GetCurrentThread();
     }
+    CRITICAL_SECTION_EXIT;
 
-    /* Interrupt triggered by data transmission */
-    if (TempIsr & USART_ISR_TXE)
+    if (MustWait)
     {
-        if (!Fifo_Empty(Usart2Handle.TxFifo))
-        {
-            U8 TxData;
-            Fifo_ReadByte(Usart2Handle.TxFifo, &TxData);
-            USART2->TDR = TxData;
-        }
-        else
-        {
-            Usart2Handle.TxBusy = False;
-            Uart_TxInterruptDisable(USART2);
-        }
+        (void)Osal_NotifyWait(Timeout_ms);
+        CRITICAL_SECTION_ENTER;
+        Uart->TxWaiter = NULL;
+        CRITICAL_SECTION_EXIT;
+    }
+    return Uart_Transmit(Uart, Data, Length);
+}
+
+Bool Uart_AwaitBaudRateSwitch(Uart_HandleType Uart, U32 Timeout_ms)
+{
+    Osal_NotifyClear();
+    CRITICAL_SECTION_ENTER;
+    const Bool MustWait = Uart->BaudRatePending;
+    if (MustWait)
+    {
+        /* Never reached, only the switch wakes the waiter */
+        Uart->TxThreshold = Uart->TxFifo->Length + 1U;
+        Uart->TxWaiter = Osal_GetCurrentThread();
     }
+    CRITICAL_SECTION_EXIT;
 
-    /* Interrupt triggered by Rx data match */
-    if ( TempIsr & USART_ISR_CMF )
+    if (MustWait)
     {
-        /* Wait for DMA to finish ongoing transfers. */
-        while (USART2->ISR & USART_ISR_RXNE) { __NOP(); }
-        /* Get status data needed from DMA peripheral. */
-        /* Disable the DMA channel. */
-        /* Notify upper layers of the new message. */
-        /* Reconfigure DMA channel with a new buffer. */
-        /* Re-enable DMA channel. */
+        (void)Osal_NotifyWait(Timeout_ms);
+        CRITICAL_SECTION_ENTER;
+        Uart->TxWaiter = NULL;
+        CRITICAL_SECTION_EXIT;
     }
+    return !Uart->BaudRatePending;
+}
+#endif /* UART_RTOS_ENABLE */
 
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+U32 Uart_GetRxTimestamp(Uart_HandleType Uart)
+{
+    return Uart->RxTimestamp;
 }
-#endif /* USART2_ENABLE */
+
+Bool Uart_GetTxCompleteTimestamp(Uart_HandleType Uart, U32* Timestamp)
+{
+    CRITICAL_SECTION_ENTER;
+    const Bool Valid = Uart->TxTimestampValid;
+    if (Valid) { *Timestamp = Uart->TxTimestamp; }
+    Uart->TxTimestampValid = False;
+    CRITICAL_SECTION_EXIT;
+    return Valid;
+}
+#endif /* UART_TIMESTAMP_ENABLE */
+
+/* ------------------------------- Interrupt handlers ------------------------------ */
 
 /**
- * @brief Interrupt handler for USART3.
+ * @brief Interrupt driven transmission & reception through the FIFOs of the given handle.
+ *        Forced inline into each of the per-instance handlers below, which are installed
+ *        in the vector table by Uart_Init() for enabled instances only.
+ * @param Uart UART peripheral handle.
+ * @note Line errors are counted & cleared, and the data register is always read,
+ *       so that the receiver keeps running when the input buffer is full.
  */
-#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
-void USART3_IRQHandler(void)
+__attribute__((always_inline))
+static inline void Uart_FifoInterruptHandler(Uart_HandleType Uart)
 {
-    const U32 TempIsr = USART3->ISR;
+    USART_TypeDef* const Instance = Uart->Instance;
+    const U32 TempIsr = Instance->ISR;
+    const U32 TempCr1 = Instance->CR1;
+    const U32 LineErrors = TempIsr & UART_LINE_ERROR_FLAGS;
 
-    /* Interrupt triggered by data reception */
-    if (TempIsr & USART_ISR_RXNE)
+    /* Line errors, left set they stall the receiver or retrigger the interrupt */
+    if (LineErrors)
     {
-        if (!Fifo_Full(Usart3Handle.RxFifo))
+        Instance->ICR = LineErrors;
+        for (U8 i = 0; i < (sizeof(UartLineErrors) / sizeof(UartLineErrors[0])); i++)
         {
-            const U8 RxData = (U8)(USART3->RDR & 0xFFUL);
-            Fifo_WriteByte(Usart3Handle.RxFifo, RxData);
+            if (LineErrors & UartLineErrors[i].Flag) { Uart->ErrorCounts[UartLineErrors[i].Error]++; }
         }
     }
 
-    /* Interrupt triggered by data transmission */
-    if (TempIsr & USART_ISR_TXE)
+    /* Interrupt triggered by data reception */
+    if ( (TempIsr & USART_ISR_RXNE) && (TempCr1 & USART_CR1_RXNEIE) )
     {
-        if (!Fifo_Empty(Usart3Handle.TxFifo))
+        if (Fifo_Full(Uart->RxFifo) && Uart->RtsFlowControl)
         {
-            U8 TxData;
-            Fifo_ReadByte(Usart3Handle.TxFifo, &TxData);
-            USART3->TDR = TxData;
+            /* Leave the data register unread, RTS is deasserted until a reader makes room. */
+            Uart_RxInterruptDisable(Instance);
         }
         else
         {
-            Usart3Handle.TxBusy = False;
-            USART3->CR1 &= ~USART_CR1_TXEIE;
+            const U8 RxData = (U8)(Instance->RDR & 0xFFUL);
+            if (LineErrors & (USART_ISR_FE | USART_ISR_PE)) { /* Corrupt byte, counted above */ }
+            else if (Fifo_Full(Uart->RxFifo)) { Uart->ErrorCounts[UART_ERROR_DROP]++; }
+            else
+            {
+                Fifo_WriteByte(Uart->RxFifo, RxData);
+                Uart_RxTimestamp(Uart);
+            }
         }
+        Uart_RxWakeCheck(Uart, False);
     }
-}
-#endif /* USART3_ENABLE */
-
-/**
- * @brief Interrupt handler for UART4.
- */
-#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
-void UART4_IRQHandler(void)
-{
-    const U32 TempIsr = UART4->ISR;
 
-    /* Interrupt triggered by data reception */
-    if (TempIsr & USART_ISR_RXNE)
+    /* Interrupt triggered by data transmission */
+    if ( (TempIsr & USART_ISR_TXE) && (TempCr1 & USART_CR1_TXEIE) )
     {
-        if (!Fifo_Full(Uart4Handle.RxFifo))
+        if (Fifo_Empty(Uart->TxFifo))
         {
-            const U8 RxData = (U8)(UART4->RDR & 0xFFUL);
-            Fifo_WriteByte(Uart4Handle.RxFifo, RxData);
+            Uart->TxBusy = False;
+            Uart_TxInterruptDisable(Instance);
+            Uart_TxTimestampArm(Uart);
         }
-    }
-
-    /* Interrupt triggered by data transmission */
-    if (TempIsr & USART_ISR_TXE)
-    {
-        if (!Fifo_Empty(Uart4Handle.TxFifo))
+        else if ( (Uart->TxDma != NULL) && (Fifo_GetNofItems(Uart->TxFifo) >= UART_DMA_TX_THRESHOLD) )
         {
-            U8 TxData;
-            Fifo_ReadByte(Uart4Handle.TxFifo, &TxData);
-            UART4->TDR = TxData;
+            /* Enough data queued meanwhile, hand over to DMA. */
+            Uart_TxInterruptDisable(Instance);
+            Uart_TxStart(Uart);
         }
         else
         {
-            Uart4Handle.TxBusy = False;
-            UART4->CR1 &= ~USART_CR1_TXEIE;
+            U8 TxData;
+            Fifo_ReadByte(Uart->TxFifo, &TxData);
+            Instance->TDR = TxData;
+        }
+        Uart_TxWakeCheck(Uart, False);
+    }
+
+    /* Last byte of the output buffer left the shift register */
+    if ( (TempIsr & USART_ISR_TC) && (TempCr1 & USART_CR1_TCIE) )
+    {
+        Instance->CR1 &= ~USART_CR1_TCIE;
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+        if (!Uart->TxBusy)
+        {
+            Uart->TxTimestamp = ReadCycleCounter();
+            Uart->TxTimestampValid = True;
         }
+#endif /* UART_TIMESTAMP_ENABLE */
+        Uart_BaudRateSwitchCheck(Uart);
+    }
+
+    /* Line went idle after a burst received by DMA */
+    if ( (TempIsr & USART_ISR_IDLE) && (TempCr1 & USART_CR1_IDLEIE) )
+    {
+        Instance->ICR = USART_ICR_IDLECF;
+        Uart_RxDmaPublish(Uart);
+        Uart_RxWakeCheck(Uart, False);
+    }
+
+    /* Woken from Stop mode, received data is handled above */
+    if ( (TempIsr & USART_ISR_WUF) && (Instance->CR3 & USART_CR3_WUFIE) )
+    {
+        Instance->ICR = USART_ICR_WUCF;
+    }
+
+    /* Character match marks the end of data for a blocked reader */
+    if (TempIsr & USART_ISR_CMF)
+    {
+        Instance->ICR = USART_ICR_CMCF;
+        if (Uart->RxDma != NULL) { Uart_RxDmaPublish(Uart); }
+        Uart_RxWakeCheck(Uart, True);
     }
 }
-#endif /* UART4_ENABLE */
 
 /**
- * @brief Interrupt handler for UART5.
+ * @brief Reception DMA channel interrupt handling, publishes data upon half & complete
+ *        transfer of the input buffer. Forced inline into the per-instance handlers below.
+ * @param Uart UART peripheral handle.
+ * @note A transfer error disables the channel, reception is restarted from the start
+ *       of the buffer, discarding unread data.
  */
-#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
-void UART5_IRQHandler(void)
+__attribute__((always_inline))
+static inline void Uart_RxDmaInterruptHandler(Uart_HandleType Uart)
 {
-    const U32 TempIsr = UART5->ISR;
+    const U8 Flags = Dma_GetFlags(Uart->RxDma);
+    Dma_ClearFlags(Uart->RxDma, Flags);
 
-    /* Interrupt triggered by data reception */
-    if (TempIsr & USART_ISR_RXNE)
+    if (Flags & DMA_FLAG_TRANSFER_ERROR)
     {
-        if (!Fifo_Full(Uart5Handle.RxFifo))
-        {
-            const U8 RxData = (U8)(UART5->RDR & 0xFFUL);
-            Fifo_WriteByte(Uart5Handle.RxFifo, RxData);
-        }
+        Fifo_Clear(Uart->RxFifo, False);
+        Uart->RxDmaPosition = 0U;
+        Dma_ChannelDisable(Uart->RxDma);
+        Dma_SetTransfer(Uart->RxDma, &Uart->Instance->RDR, Uart->RxFifo->Buffer, Uart->RxFifo->Length);
+        Dma_ChannelEnable(Uart->RxDma);
+    }
+    else if (Flags & (DMA_FLAG_HALF_TRANSFER | DMA_FLAG_TRANSFER_COMPLETE))
+    {
+        Uart_RxDmaPublish(Uart);
+        Uart_RxWakeCheck(Uart, False);
     }
+}
 
-    /* Interrupt triggered by data transmission */
-    if (TempIsr & USART_ISR_TXE)
+/**
+ * @brief Transmission DMA channel interrupt handling, releases the transferred span of the
+ *        output buffer & chains the next one. Forced inline into the per-instance handlers below.
+ * @param Uart UART peripheral handle.
+ * @note The span is released on transfer error as well, its data is lost.
+ */
+__attribute__((always_inline))
+static inline void Uart_TxDmaInterruptHandler(Uart_HandleType Uart)
+{
+    const U8 Flags = Dma_GetFlags(Uart->TxDma);
+    Dma_ClearFlags(Uart->TxDma, Flags);
+
+    if (Flags & (DMA_FLAG_TRANSFER_COMPLETE | DMA_FLAG_TRANSFER_ERROR))
     {
-        if (!Fifo_Empty(Uart5Handle.TxFifo))
-        {
-            U8 TxData;
-            Fifo_ReadByte(Uart5Handle.TxFifo, &TxData);
-            UART5->TDR = TxData;
-        }
-        else
+        Dma_ChannelDisable(Uart->TxDma);
+        Fifo_CommitRead(Uart->TxFifo, Uart->TxDmaCount);
+        Uart->TxDmaCount = 0U;
+
+        if (Fifo_Empty(Uart->TxFifo))
         {
-            Uart5Handle.TxBusy = False;
-            UART5->CR1 &= ~USART_CR1_TXEIE;
+            Uart->TxBusy = False;
+            Uart_TxTimestampArm(Uart);
         }
+        else { Uart_TxStart(Uart); }
+        Uart_TxWakeCheck(Uart, False);
     }
 }
+
+#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+/**
+ * @brief Interrupt handler for USART1.
+ */
+RAMFUNC static void Usart1_IrqHandler(void)
+{
+    Uart_FifoInterruptHandler(&Usart1Handle);
+}
+#endif /* USART1_ENABLE */
+
+#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+/**
+ * @brief Interrupt handler for USART2.
+ */
+RAMFUNC static void Usart2_IrqHandler(void)
+{
+    Uart_FifoInterruptHandler(&Usart2Handle);
+}
+#endif /* USART2_ENABLE */
+
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+/**
+ * @brief Interrupt handler for USART3.
+ */
+RAMFUNC static void Usart3_IrqHandler(void)
+{
+    Uart_FifoInterruptHandler(&Usart3Handle);
+}
+#endif /* USART3_ENABLE */
+
+#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+/**
+ * @brief Interrupt handler for UART4.
+ */
+RAMFUNC static void Uart4_IrqHandler(void)
+{
+    Uart_FifoInterruptHandler(&Uart4Handle);
+}
+#endif /* UART4_ENABLE */
+
+#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+/**
+ * @brief Interrupt handler for UART5.
+ */
+RAMFUNC static void Uart5_IrqHandler(void)
+{
+    Uart_FifoInterruptHandler(&Uart5Handle);
+}
 #endif /* UART5_ENABLE */
 
+#if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
 /**
  * @brief Interrupt handler for LPUART1.
  */
+RAMFUNC static void Lpuart1_IrqHandler(void)
+{
+    Uart_FifoInterruptHandler(&Lpuart1Handle);
+}
+#endif /* LPUART1_ENABLE */
+
+#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+/**
+ * @brief Reception DMA channel interrupt handler for USART1.
+ */
+RAMFUNC static void Usart1_RxDmaIrqHandler(void)
+{
+    Uart_RxDmaInterruptHandler(&Usart1Handle);
+}
+#endif /* USART1_ENABLE */
+
+#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+/**
+ * @brief Reception DMA channel interrupt handler for USART2.
+ */
+RAMFUNC static void Usart2_RxDmaIrqHandler(void)
+{
+    Uart_RxDmaInterruptHandler(&Usart2Handle);
+}
+#endif /* USART2_ENABLE */
+
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+/**
+ * @brief Reception DMA channel interrupt handler for USART3.
+ */
+RAMFUNC static void Usart3_RxDmaIrqHandler(void)
+{
+    Uart_RxDmaInterruptHandler(&Usart3Handle);
+}
+#endif /* USART3_ENABLE */
+
+#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+/**
+ * @brief Reception DMA channel interrupt handler for UART4.
+ */
+RAMFUNC static void Uart4_RxDmaIrqHandler(void)
+{
+    Uart_RxDmaInterruptHandler(&Uart4Handle);
+}
+#endif /* UART4_ENABLE */
+
+#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+/**
+ * @brief Reception DMA channel interrupt handler for UART5.
+ */
+RAMFUNC static void Uart5_RxDmaIrqHandler(void)
+{
+    Uart_RxDmaInterruptHandler(&Uart5Handle);
+}
+#endif /* UART5_ENABLE */
+
 #if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
-void LPUART1_IRQHandler(void)
+/**
+ * @brief Reception DMA channel interrupt handler for LPUART1.
+ */
+RAMFUNC static void Lpuart1_RxDmaIrqHandler(void)
 {
-    const U32 TempIsr = LPUART1->ISR;
+    Uart_RxDmaInterruptHandler(&Lpuart1Handle);
+}
+#endif /* LPUART1_ENABLE */
 
-    /* Interrupt triggered by data reception */
-    if (TempIsr & USART_ISR_RXNE)
-    {
-        if (!Fifo_Full(Lpuart1Handle.RxFifo))
-        {
-            const U8 RxData = (U8)(LPUART1->RDR & 0xFFUL);
-            Fifo_WriteByte(Lpuart1Handle.RxFifo, RxData);
-        }
-    }
+#if defined(USART1_ENABLE) && (USART1_ENABLE == 1U)
+/**
+ * @brief Transmission DMA channel interrupt handler for USART1.
+ */
+RAMFUNC static void Usart1_TxDmaIrqHandler(void)
+{
+    Uart_TxDmaInterruptHandler(&Usart1Handle);
+}
+#endif /* USART1_ENABLE */
 
-    /* Interrupt triggered by data transmission */
-    if (TempIsr & USART_ISR_TXE)
-    {
-        if (!Fifo_Empty(Lpuart1Handle.TxFifo))
-        {
-            U8 TxData;
-            Fifo_ReadByte(Lpuart1Handle.TxFifo, &TxData);
-            LPUART1->TDR = TxData;
-        }
-        else
-        {
-            Lpuart1Handle.TxBusy = False;
-            LPUART1->CR1 &= ~USART_CR1_TXEIE;
-        }
-    }
+#if defined(USART2_ENABLE) && (USART2_ENABLE == 1U)
+/**
+ * @brief Transmission DMA channel interrupt handler for USART2.
+ */
+RAMFUNC static void Usart2_TxDmaIrqHandler(void)
+{
+    Uart_TxDmaInterruptHandler(&Usart2Handle);
+}
+#endif /* USART2_ENABLE */
+
+#if defined(USART3_ENABLE) && (USART3_ENABLE == 1U)
+/**
+ * @brief Transmission DMA channel interrupt handler for USART3.
+ */
+RAMFUNC static void Usart3_TxDmaIrqHandler(void)
+{
+    Uart_TxDmaInterruptHandler(&Usart3Handle);
+}
+#endif /* USART3_ENABLE */
+
+#if defined(UART4_ENABLE) && (UART4_ENABLE == 1U)
+/**
+ * @brief Transmission DMA channel interrupt handler for UART4.
+ */
+RAMFUNC static void Uart4_TxDmaIrqHandler(void)
+{
+    Uart_TxDmaInterruptHandler(&Uart4Handle);
 }
 #endif /* UART4_ENABLE */
+
+#if defined(UART5_ENABLE) && (UART5_ENABLE == 1U)
+/**
+ * @brief Transmission DMA channel interrupt handler for UART5.
+ */
+RAMFUNC static void Uart5_TxDmaIrqHandler(void)
+{
+    Uart_TxDmaInterruptHandler(&Uart5Handle);
+}
+#endif /* UART5_ENABLE */
+
+#if defined(LPUART1_ENABLE) && (LPUART1_ENABLE == 1U)
+/**
+ * @brief Transmission DMA channel interrupt handler for LPUART1.
+ */
+RAMFUNC static void Lpuart1_TxDmaIrqHandler(void)
+{
+    Uart_TxDmaInterruptHandler(&Lpuart1Handle);
+}
+#endif /* LPUART1_ENABLE */
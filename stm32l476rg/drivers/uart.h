@@ -15,9 +15,31 @@
 
 /* ---------------------------- Preprocessor directives ---------------------------- */
 #define UART_IRQ_PRIO           (6U)
+
+/**
+ * @brief Default input & output buffer sizes, a power of two up to 32768.
+ */
 #define UART_TX_BUFFER_SIZE     (128U)
 #define UART_RX_BUFFER_SIZE     (128U)
 
+/**
+ * @brief In DMA transmission mode writes leaving fewer bytes than this queued are
+ *        sent in interrupt mode, where the DMA channel setup would cost more than it saves.
+ */
+#define UART_DMA_TX_THRESHOLD   (8U)
+
+/**
+ * @brief Set to (1U) to provide the blocking Uart_ReadTimeout() & Uart_WriteTimeout(),
+ *        which put the calling thread to sleep through the OSAL.
+ */
+#define UART_RTOS_ENABLE        (1U)
+
+/**
+ * @brief Set to (1U) to stamp reception & transmission complete events with the
+ *        DWT cycle counter, which has to be enabled through EnableCycleCounter().
+ */
+#define UART_TIMESTAMP_ENABLE   (1U)
+
 /**
  * @note In order to save RAM only USART peripherals for which these defines
  *       are set are usable.
@@ -29,6 +51,23 @@
 #define UART5_ENABLE    (0U)
 #define LPUART1_ENABLE  (0U)
 
+/**
+ * @brief Per-instance sizes of the driver owned input & output buffers, a power of
+ *        two up to 32768. Unused if buffers are supplied through Uart_ConfigType.
+ */
+#define USART1_TX_BUFFER_SIZE   (UART_TX_BUFFER_SIZE)
+#define USART1_RX_BUFFER_SIZE   (UART_RX_BUFFER_SIZE)
+#define USART2_TX_BUFFER_SIZE   (UART_TX_BUFFER_SIZE)
+#define USART2_RX_BUFFER_SIZE   (UART_RX_BUFFER_SIZE)
+#define USART3_TX_BUFFER_SIZE   (UART_TX_BUFFER_SIZE)
+#define USART3_RX_BUFFER_SIZE   (UART_RX_BUFFER_SIZE)
+#define UART4_TX_BUFFER_SIZE    (UART_TX_BUFFER_SIZE)
+#define UART4_RX_BUFFER_SIZE    (UART_RX_BUFFER_SIZE)
+#define UART5_TX_BUFFER_SIZE    (UART_TX_BUFFER_SIZE)
+#define UART5_RX_BUFFER_SIZE    (UART_RX_BUFFER_SIZE)
+#define LPUART1_TX_BUFFER_SIZE  (UART_TX_BUFFER_SIZE)
+#define LPUART1_RX_BUFFER_SIZE  (UART_RX_BUFFER_SIZE)
+
 /*  -------------------------- Structures & enumerations --------------------------- */
 
 /**
@@ -80,6 +119,93 @@ typedef enum
     UART_SAMPLING_1_BIT = 0x1U      /* Sampling of a single bit       */
 } Uart_SamplingMethodEnum;
 
+/**
+ * @brief Enumeration of the available data transfer modes.
+ */
+typedef enum
+{
+    UART_TRANSFER_MODE_INTERRUPT = 0x0U,    /* One interrupt per transferred byte */
+    UART_TRANSFER_MODE_DMA = 0x1U           /* DMA transfers, interrupts per burst */
+} Uart_TransferModeEnum;
+
+/**
+ * @brief Enumeration of the available hardware flow control settings.
+ */
+typedef enum
+{
+    UART_FLOW_CONTROL_NONE = 0x0U,
+    UART_FLOW_CONTROL_RTS = 0x1U,       /* Request to send output, deasserted when reception stalls */
+    UART_FLOW_CONTROL_CTS = 0x2U,       /* Clear to send input, transmission paused while deasserted */
+    UART_FLOW_CONTROL_RTS_CTS = 0x3U
+} Uart_FlowControlEnum;
+
+/**
+ * @brief Enumeration of the available settings for the RS-485 driver enable output.
+ */
+typedef enum
+{
+    UART_DRIVER_ENABLE_NONE = 0x0U,
+    UART_DRIVER_ENABLE_ACTIVE_HIGH = 0x1U,
+    UART_DRIVER_ENABLE_ACTIVE_LOW = 0x2U
+} Uart_DriverEnableEnum;
+
+/**
+ * @brief Enumeration of the available multiprocessor mute mode settings.
+ */
+typedef enum
+{
+    UART_MUTE_MODE_NONE = 0x0U,
+    UART_MUTE_MODE_IDLE_LINE = 0x1U,    /* Woken by an idle line, muted on request */
+    UART_MUTE_MODE_ADDRESS_MARK = 0x2U  /* Woken by a matching address byte, muted by any other */
+} Uart_MuteModeEnum;
+
+/**
+ * @brief Enumeration of the available node address lengths for address mark wake-up.
+ */
+typedef enum
+{
+    UART_ADDRESS_4BIT = 0x0U,           /* Compared to the 4 LSBs of bytes with the MSB set */
+    UART_ADDRESS_7BIT = 0x1U            /* Compared to the 7 LSBs of bytes with the MSB set */
+} Uart_AddressLengthEnum;
+
+/**
+ * @brief Enumeration of the available kernel clock sources of a UART peripheral,
+ *        values match the RCC_CCIPR selection field.
+ */
+typedef enum
+{
+    UART_CLOCK_SOURCE_PCLK = 0x0U,      /* PCLK2 for USART1, PCLK1 for the others */
+    UART_CLOCK_SOURCE_SYSCLK = 0x1U,
+    UART_CLOCK_SOURCE_HSI = 0x2U,       /* Started in Stop mode on request of the peripheral */
+    UART_CLOCK_SOURCE_LSE = 0x3U        /* Running in Stop mode, up to 9600 baud with LPUART1 */
+} Uart_ClockSourceEnum;
+
+/**
+ * @brief Enumeration of the available wake-up from Stop mode events. LPUART1 keeps
+ *        receiving in Stop 2, the other instances in Stop 0 & Stop 1, provided the
+ *        kernel clock is HSI or LSE.
+ */
+typedef enum
+{
+    UART_STOP_WAKEUP_NONE = 0x0U,           /* Peripheral is frozen in Stop mode */
+    UART_STOP_WAKEUP_START_BIT = 0x1U,      /* Woken at the start bit, byte is received in Run mode */
+    UART_STOP_WAKEUP_RXNE = 0x2U,           /* Woken once a byte has been received */
+    UART_STOP_WAKEUP_ADDRESS_MATCH = 0x3U   /* Woken by a byte with the MSB set matching the node address */
+} Uart_StopWakeupEnum;
+
+/**
+ * @brief Enumeration of the reception errors counted per UART peripheral.
+ */
+typedef enum
+{
+    UART_ERROR_DROP = 0x0U,         /* Received byte discarded, input buffer full */
+    UART_ERROR_OVERRUN = 0x1U,      /* Received byte lost, data register not read in time */
+    UART_ERROR_FRAMING = 0x2U,      /* Stop bit not detected, byte discarded */
+    UART_ERROR_NOISE = 0x3U,        /* Noise detected, byte kept */
+    UART_ERROR_PARITY = 0x4U,       /* Parity mismatch, byte discarded */
+    UART_ERROR_ENUM_LIMIT
+} Uart_ErrorEnum;
+
 /**
  * @brief UART peripheral configuration structure.
  */
@@ -93,6 +219,24 @@ typedef struct
     Uart_SamplingMethodEnum SamplingMethod;
     Uart_ParityEnum Parity;
     Uart_StopBitsEnum StopBits;
+    Uart_TransferModeEnum RxMode;
+    Uart_TransferModeEnum TxMode;
+    Uart_FlowControlEnum FlowControl;
+    Pin_PortPinEnum RtsPin;             /* Only used with RTS flow control */
+    Pin_PortPinEnum CtsPin;             /* Only used with CTS flow control */
+    Uart_DriverEnableEnum DriverEnable; /* RS-485 transceiver driver enable, replaces RTS */
+    Pin_PortPinEnum DePin;              /* Only used with driver enable, the RTS pin of the peripheral */
+    U8 DeAssertionTime;                 /* Driver enable lead before the start bit, 0-31 sample times */
+    U8 DeDeassertionTime;               /* Driver enable lag after the last stop bit, 0-31 sample times */
+    Uart_MuteModeEnum MuteMode;
+    Uart_AddressLengthEnum AddressLength; /* Only used with address mark & address match wake-up */
+    U8 NodeAddress;                     /* Only used with address mark & address match wake-up */
+    Uart_ClockSourceEnum ClockSource;
+    Uart_StopWakeupEnum StopWakeup;     /* Requires HSI or LSE as clock source */
+    U8* TxBuffer;                       /* Caller owned output buffer, NULL = driver owned buffer */
+    U16 TxBufferSize;                   /* Only used with a caller owned output buffer, a power of two up to 32768 */
+    U8* RxBuffer;                       /* Caller owned input buffer, NULL = driver owned buffer */
+    U16 RxBufferSize;                   /* Only used with a caller owned input buffer, a power of two up to 32768 */
 } Uart_ConfigType;
 
 /**
@@ -147,7 +291,25 @@ void Uart_Disable(Uart_HandleType Uart);
  * @brief Initialize the given UART peripheral.
  * @param Uart Pointer to USART peripheral structure.
  * @param Config Pointer to configuration structure.
- * @return Handle to the initialized peripheral.
+ * @return Handle to the initialized peripheral, NULL if the instance is not enabled
+ *         or a caller owned buffer size is 0, above 32768 or not a power of two.
+ * @note Caller owned buffers must remain valid for as long as the peripheral is in use.
+ * @note In DMA reception mode a circular DMA channel writes received data straight
+ *       into the input buffer. New data is published to readers upon idle-line
+ *       detection and when the buffer is half & completely filled. In DMA transmission
+ *       mode the largest contiguous span of the output buffer is transferred at a time,
+ *       the next span is chained upon transfer complete. Should a DMA channel be
+ *       occupied the direction in question falls back to interrupt mode.
+ * @note With RTS flow control in interrupt reception mode the receiver is stalled, rather
+ *       than data dropped, while the input buffer is full. RTS is then deasserted until
+ *       data is read. In DMA reception mode RTS only covers interrupt latency as the
+ *       circular DMA channel keeps reading.
+ * @note The driver enable output is asserted & deasserted by hardware around each transmission,
+ *       timed in sample times of 1/16 or 1/8 bit depending on oversampling. It shares the pin
+ *       with RTS, RTS flow control is not available while it is in use.
+ * @note In mute mode the receiver discards all data without raising interrupts until
+ *       woken. Address mark wake-up uses the same address register as the character
+ *       match interrupt, the two can not be used at the same time.
  */
 Uart_HandleType Uart_Init(USART_TypeDef* Uart, const Uart_ConfigType* Config);
 
@@ -189,7 +351,7 @@ Bool Uart_TransmitChar(Uart_HandleType Uart, Char Data);
  * @return Boolean indicating if the data was successfully
  *         added to the transmission queue.
  */
-Bool Uart_TransmitString(Uart_HandleType Uart, const Char* Data, U8 Length);
+Bool Uart_TransmitString(Uart_HandleType Uart, const Char* Data, U16 Length);
 
 
 /**
@@ -211,7 +373,7 @@ Bool Uart_RecieveChar(Uart_HandleType Uart, Char* RxData);
  * @return Boolean indicating if the data was successfully
  *         recieved.
  */
-Bool Uart_Recieve(Uart_HandleType Uart, U8* RxData, U8 Length);
+Bool Uart_Recieve(Uart_HandleType Uart, U8* RxData, U16 Length);
 
 /**
  * @brief Transmit the given number of bytes of data from the
@@ -222,7 +384,7 @@ Bool Uart_Recieve(Uart_HandleType Uart, U8* RxData, U8 Length);
  * @return Boolean indicating if the data was successfully
  *         transmitted.
  */
-Bool Uart_Transmit(Uart_HandleType Uart, const U8* Data, U8 Length);
+Bool Uart_Transmit(Uart_HandleType Uart, const U8* Data, U16 Length);
 
 /**
  * @brief Clear the reciver buffer of the given UART.
@@ -235,14 +397,29 @@ void Uart_RxBufferClear(Uart_HandleType Uart);
  * @param Uart UART peripheral handle.
  * @return Number of unread bytes in the input buffer.
  */
-U8 Uart_GetNofInputBufferBytes(Uart_HandleType Uart);
+U16 Uart_GetNofInputBufferBytes(Uart_HandleType Uart);
 
 /**
  * @brief Get the number of bytes in the output buffer of the given UART peripheral.
  * @param Uart UART peripheral handle.
  * @return Number of unread bytes in the output buffer.
  */
-U8 Uart_GetNofOutputBufferBytes(Uart_HandleType Uart);
+U16 Uart_GetNofOutputBufferBytes(Uart_HandleType Uart);
+
+/**
+ * @brief Request the receiver of the given UART peripheral to enter mute mode, e.g.
+ *        upon reception of an address not matching the node with idle line wake-up.
+ * @param Uart UART peripheral handle.
+ * @note Has no effect unless a mute mode is configured through Uart_ConfigType.
+ */
+void Uart_EnterMuteMode(Uart_HandleType Uart);
+
+/**
+ * @brief Check whether the receiver of the given UART peripheral is muted.
+ * @param Uart UART peripheral handle.
+ * @return True = muted, False = receiving.
+ */
+Bool Uart_IsMuted(Uart_HandleType Uart);
 
 /**
  * @brief Enable the character match interrupt for the given UART peripheral.
@@ -257,4 +434,109 @@ void Uart_CharacterMatchInterruptEnable(Uart_HandleType Uart, U8 MatchByte);
  */
 void Uart_CharacterMatchInterruptDisable(Uart_HandleType Uart);
 
+/**
+ * @brief Check if the given baud rate is attainable by the given UART peripheral
+ *        with its current peripheral clock & oversampling setting.
+ * @param Uart UART peripheral handle.
+ * @param BaudRate The desired baud rate.
+ * @param BaudError_ppm Deviation of the attainable from the desired baud rate
+ *        in parts per million, may be NULL.
+ * @return RC_OK = attainable, RC_ERROR = out of range.
+ */
+ReturnCodeEnum Uart_CheckBaudRate(Uart_HandleType Uart, U32 BaudRate, S32* BaudError_ppm);
+
+/**
+ * @brief Change the baud rate of the given UART peripheral. The baud rate register value
+ *        is rounded to nearest. During transmission the change is deferred until the last
+ *        queued byte has left the shift register, it is then applied from the transmission
+ *        complete interrupt. Data queued meanwhile is still sent at the current baud rate.
+ * @param Uart UART peripheral handle.
+ * @param BaudRate The desired baud rate.
+ * @param BaudError_ppm Deviation of the resulting from the desired baud rate
+ *        in parts per million, may be NULL.
+ * @return RC_OK = changed or change pending, RC_ERROR = out of range, baud rate left unchanged.
+ * @note See Uart_IsBaudRateSwitchPending() & Uart_AwaitBaudRateSwitch().
+ */
+ReturnCodeEnum Uart_SetBaudRate(Uart_HandleType Uart, U32 BaudRate, S32* BaudError_ppm);
+
+/**
+ * @brief Check if a baud rate change of the given UART peripheral awaits the end of transmission.
+ * @param Uart UART peripheral handle.
+ * @return True = pending, False = applied.
+ */
+Bool Uart_IsBaudRateSwitchPending(Uart_HandleType Uart);
+
+/**
+ * @brief Get the number of reception errors of the given kind since
+ *        initialization or the last call to Uart_ClearErrorCounts().
+ * @param Uart UART peripheral handle.
+ * @param Error Kind of reception error.
+ * @return Number of errors, 0 for an invalid kind.
+ */
+U32 Uart_GetErrorCount(Uart_HandleType Uart, Uart_ErrorEnum Error);
+
+/**
+ * @brief Reset the reception error counters of the given UART peripheral.
+ * @param Uart UART peripheral handle.
+ */
+void Uart_ClearErrorCounts(Uart_HandleType Uart);
+
+#if defined(UART_RTOS_ENABLE) && (UART_RTOS_ENABLE == 1U)
+/**
+ * @brief Read data from the given UART peripheral, blocking the calling thread until
+ *        the requested number of bytes is available, the character match byte is
+ *        received (see Uart_CharacterMatchInterruptEnable()) or the timeout elapses.
+ * @param Uart UART peripheral handle.
+ * @param RxData Pointer to recieved data storage.
+ * @param Length The desired amount of data to read.
+ * @param Timeout_ms Timeout in milliseconds, OSAL_WAIT_FOREVER to wait indefinitely.
+ * @return Number of bytes read, fewer than requested upon character match or timeout.
+ * @note Only one thread at a time may read from a given UART peripheral.
+ */
+U16 Uart_ReadTimeout(Uart_HandleType Uart, U8* RxData, U16 Length, U32 Timeout_ms);
+
+/**
+ * @brief Transmit data from the given UART peripheral, blocking the calling thread until
+ *        there is room for it in the output buffer or the timeout elapses.
+ * @param Uart UART peripheral handle.
+ * @param Data Pointer to transmission data storage.
+ * @param Length The desired amount of data to send.
+ * @param Timeout_ms Timeout in milliseconds, OSAL_WAIT_FOREVER to wait indefinitely.
+ * @return Boolean indicating if the data was successfully
+ *         added to the transmission queue.
+ * @note Only one thread at a time may write to a given UART peripheral.
+ */
+Bool Uart_WriteTimeout(Uart_HandleType Uart, const U8* Data, U16 Length, U32 Timeout_ms);
+
+/**
+ * @brief Block the calling thread until a pending baud rate change of the given UART
+ *        peripheral is applied or the timeout elapses, see Uart_SetBaudRate().
+ * @param Uart UART peripheral handle.
+ * @param Timeout_ms Timeout in milliseconds, OSAL_WAIT_FOREVER to wait indefinitely.
+ * @return True = applied, False = still pending.
+ * @note Shares the writer wake-up, must not be used concurrently with Uart_WriteTimeout().
+ */
+Bool Uart_AwaitBaudRateSwitch(Uart_HandleType Uart, U32 Timeout_ms);
+#endif /* UART_RTOS_ENABLE */
+
+#if defined(UART_TIMESTAMP_ENABLE) && (UART_TIMESTAMP_ENABLE == 1U)
+/**
+ * @brief Get the cycle counter value at which received data was last made available
+ *        to readers of the given UART peripheral, i.e. upon reception of each byte in
+ *        interrupt mode & upon idle line, character match or half/full buffer in DMA mode.
+ * @param Uart UART peripheral handle.
+ * @return Cycle counter value.
+ */
+U32 Uart_GetRxTimestamp(Uart_HandleType Uart);
+
+/**
+ * @brief Get the cycle counter value at which the last byte of the output buffer
+ *        left the shift register of the given UART peripheral.
+ * @param Uart UART peripheral handle.
+ * @param Timestamp Cycle counter value, only written if a new value is available.
+ * @return True = transmission completed since the last call, False = no new value.
+ */
+Bool Uart_GetTxCompleteTimestamp(Uart_HandleType Uart, U32* Timestamp);
+#endif /* UART_TIMESTAMP_ENABLE */
+
 #endif /* UART_H */
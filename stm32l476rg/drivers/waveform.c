@@ -0,0 +1,240 @@
+/**
+ * @file waveform.c
+ *
+ * @brief Timer paced DMA-to-GPIO waveform engine.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "waveform.h"
+#include "clock_control.h"
+#include "critical_section.h"
+
+/* ------------------------- Local preprocessor definitions ------------------------ */
+#define WAVEFORM_TIMER_MAX_RELOAD   (0x10000U)
+
+/*  -------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Timer resources pacing a waveform.
+ */
+typedef struct
+{
+    TIM_TypeDef* Instance;
+    ClkCtrl_PeripheralClockEnum Clock;
+    ClkCtrl_ClockTreeNodeEnum Bus;      /* APB clock feeding the timer. */
+    Dma_RequestEnum Request;            /* Update DMA request. */
+} Waveform_TimerMapType;
+
+/**
+ * @brief Waveform handle structure.
+ */
+struct Waveform_OpaqueHandleType
+{
+    Bool InUse;
+    const Waveform_TimerMapType* Timer;
+    Dma_HandleType Dma;
+    U8 DmaRequest;                      /* Request selection of the claimed channel. */
+    Dma_ChannelPriorityEnum Priority;
+    GPIO_TypeDef* Port;
+    Waveform_CallbackType Callback;
+    void* CallbackContext;
+    volatile Bool Busy;
+    Bool Repeat;
+};
+
+/* --------------------------------- Local variables ------------------------------- */
+static const Waveform_TimerMapType WaveformTimers[WAVEFORM_TIMER_ENUM_LIMIT] =
+{
+    [WAVEFORM_TIMER_TIM2]  = { TIM2,  PCLK_TIM2,  CLK_NODE_PCLK1, DMA_REQUEST_TIM2_UP  },
+    [WAVEFORM_TIMER_TIM3]  = { TIM3,  PCLK_TIM3,  CLK_NODE_PCLK1, DMA_REQUEST_TIM3_UP  },
+    [WAVEFORM_TIMER_TIM4]  = { TIM4,  PCLK_TIM4,  CLK_NODE_PCLK1, DMA_REQUEST_TIM4_UP  },
+    [WAVEFORM_TIMER_TIM5]  = { TIM5,  PCLK_TIM5,  CLK_NODE_PCLK1, DMA_REQUEST_TIM5_UP  },
+    [WAVEFORM_TIMER_TIM6]  = { TIM6,  PCLK_TIM6,  CLK_NODE_PCLK1, DMA_REQUEST_TIM6_UP  },
+    [WAVEFORM_TIMER_TIM7]  = { TIM7,  PCLK_TIM7,  CLK_NODE_PCLK1, DMA_REQUEST_TIM7_UP  },
+    [WAVEFORM_TIMER_TIM15] = { TIM15, PCLK_TIM15, CLK_NODE_PCLK2, DMA_REQUEST_TIM15_UP },
+    [WAVEFORM_TIMER_TIM16] = { TIM16, PCLK_TIM16, CLK_NODE_PCLK2, DMA_REQUEST_TIM16_UP },
+    [WAVEFORM_TIMER_TIM17] = { TIM17, PCLK_TIM17, CLK_NODE_PCLK2, DMA_REQUEST_TIM17_UP },
+};
+
+static struct Waveform_OpaqueHandleType Waveforms[WAVEFORM_TIMER_ENUM_LIMIT] = { 0 };
+
+/* ------------------------- Private function declarations ------------------------- */
+
+/**
+ * @brief Get the kernel clock frequency of the given timer. Timers run at twice the
+ *        APB clock frequency when the APB prescaler is not 1.
+ * @param Timer Timer resources.
+ * @return Timer clock frequency in Hz.
+ */
+static U32 Waveform_GetTimerClockFreq(const Waveform_TimerMapType* Timer);
+
+/**
+ * @brief Stop the timer & the DMA channel of the given waveform.
+ * @param Waveform Waveform handle.
+ */
+static void Waveform_Halt(Waveform_HandleType Waveform);
+
+/**
+ * @brief DMA transfer complete callback, the last sample has been output.
+ * @param Handle DMA peripheral handle.
+ * @param Context Waveform handle.
+ */
+static void Waveform_TransferCompleteCallback(Dma_HandleType Handle, void* Context);
+
+/**
+ * @brief DMA transfer error callback, stops the waveform.
+ * @param Handle DMA peripheral handle.
+ * @param Context Waveform handle.
+ */
+static void Waveform_TransferErrorCallback(Dma_HandleType Handle, void* Context);
+
+/* -------------------------- Private function definitions ------------------------- */
+
+static U32 Waveform_GetTimerClockFreq(const Waveform_TimerMapType* Timer)
+{
+    const U32 PrescalerBits = (Timer->Bus == CLK_NODE_PCLK1) ?
+        (RCC->CFGR & RCC_CFGR_PPRE1_Msk) : (RCC->CFGR & RCC_CFGR_PPRE2_Msk);
+    const U32 BusFreq = ClkCtrl_GetNodeFreq(Timer->Bus);
+    return (PrescalerBits == 0U) ? BusFreq : (BusFreq * 2U);
+}
+
+static void Waveform_Halt(Waveform_HandleType Waveform)
+{
+    TIM_TypeDef* const Tim = Waveform->Timer->Instance;
+    Tim->CR1 &= ~TIM_CR1_CEN;
+    Tim->DIER &= ~TIM_DIER_UDE;
+    Dma_ChannelDisable(Waveform->Dma);
+    Waveform->Busy = False;
+}
+
+static void Waveform_TransferCompleteCallback(Dma_HandleType Handle, void* Context)
+{
+    UNUSED(Handle);
+    Waveform_HandleType Waveform = (Waveform_HandleType)Context;
+    if (!Waveform->Repeat) { Waveform_Halt(Waveform); }
+    if (Waveform->Callback != NULL) { Waveform->Callback(Waveform, Waveform->CallbackContext); }
+}
+
+static void Waveform_TransferErrorCallback(Dma_HandleType Handle, void* Context)
+{
+    UNUSED(Handle);
+    Waveform_Halt((Waveform_HandleType)Context);
+}
+
+/* -------------------------- Public function definitions -------------------------- */
+
+Waveform_HandleType Waveform_Init(const Waveform_ConfigType* Config)
+{
+    if ( (Config->Timer >= WAVEFORM_TIMER_ENUM_LIMIT) || (Config->NofOutputs == 0U) ||
+         (Config->SampleRate_Hz == 0U) )
+    {
+        return (Waveform_HandleType)NULL;
+    }
+
+    GPIO_TypeDef* const Port = Pin_GetPort(Config->Outputs[0].PortPin);
+    for (U8 i = 1; i < Config->NofOutputs; i++)
+    {
+        if (Pin_GetPort(Config->Outputs[i].PortPin) != Port) { return (Waveform_HandleType)NULL; }
+    }
+
+    const Waveform_TimerMapType* const Timer = &WaveformTimers[Config->Timer];
+    const U32 Ticks = Waveform_GetTimerClockFreq(Timer) / Config->SampleRate_Hz;
+    if (Ticks == 0U) { return (Waveform_HandleType)NULL; }
+
+    Waveform_HandleType Waveform = &Waveforms[Config->Timer];
+    CRITICAL_SECTION_ENTER;
+    const Bool Claimed = !Waveform->InUse;
+    Waveform->InUse = True;
+    CRITICAL_SECTION_EXIT;
+    if (!Claimed) { return (Waveform_HandleType)NULL; }
+
+    Dma_Init();
+    Waveform->Dma = Dma_ClaimRequestChannel(Timer->Request, Waveform, &Waveform->DmaRequest);
+    if (Waveform->Dma == NULL)
+    {
+        Waveform->InUse = False;
+        return (Waveform_HandleType)NULL;
+    }
+
+    Waveform->Timer = Timer;
+    Waveform->Priority = Config->Priority;
+    Waveform->Port = Port;
+    Waveform->Callback = Config->Callback;
+    Waveform->CallbackContext = Config->CallbackContext;
+    Waveform->Busy = False;
+    Waveform->Repeat = False;
+
+    for (U8 i = 0; i < Config->NofOutputs; i++) { Digital_OutputInit(&Config->Outputs[i]); }
+
+    /* Counter period of at most 16 bits, split between prescaler & auto-reload */
+    const U32 Prescaler = (Ticks - 1U) / WAVEFORM_TIMER_MAX_RELOAD;
+    const U32 Reload = (Ticks / (Prescaler + 1U)) - 1U;
+    ClkCtrl_PeripheralClockEnable(Timer->Clock);
+    TIM_TypeDef* const Tim = Timer->Instance;
+    Tim->CR1 = 0U;
+    Tim->DIER = 0U;
+    Tim->PSC = Prescaler;
+    Tim->ARR = (Reload > 0U) ? Reload : 1U;
+    Tim->EGR = TIM_EGR_UG;
+    Tim->SR = 0U;
+    Tim->CR1 = TIM_CR1_ARPE;
+    return Waveform;
+}
+
+void Waveform_Deinit(Waveform_HandleType Waveform)
+{
+    Waveform_Halt(Waveform);
+    (void)Dma_ReleaseChannel(Waveform->Dma, Waveform);
+    ClkCtrl_PeripheralClockDisable(Waveform->Timer->Clock);
+    Waveform->Dma = (Dma_HandleType)NULL;
+    Waveform->InUse = False;
+}
+
+ReturnCodeEnum Waveform_Start(Waveform_HandleType Waveform, const U32* Samples, U16 Count, Bool Repeat)
+{
+    if ( Waveform->Busy || (Count == 0U) ) { return RC_ERROR; }
+
+    const Dma_ConfigType DmaCfg =
+    {
+        .Direction = DMA_TRANSFER_DIR_READ_FROM_MEMORY,
+        .Priority = Waveform->Priority,
+        .PeripheralSize = DMA_TRANSFER_SIZE_32BIT,
+        .MemorySize = DMA_TRANSFER_SIZE_32BIT,
+        .PeripheralIncrement = False,
+        .MemoryIncrement = True,
+        .Circular = Repeat,
+        .MemToMem = False,
+        .Request = Waveform->DmaRequest,
+        .TransferCompleteInterrupt = False,
+        .HalfTransferInterrupt = False,
+        .TransferErrorInterrupt = False,
+        .HalfTransferCallback = NULL,
+        .TransferCompleteCallback = Waveform_TransferCompleteCallback,
+        .TransferErrorCallback = Waveform_TransferErrorCallback,
+        .CallbackContext = Waveform
+    };
+    Dma_Configure(Waveform->Dma, &DmaCfg);
+
+    Waveform->Repeat = Repeat;
+    Waveform->Busy = True;
+    Dma_Start(Waveform->Dma, &Waveform->Port->BSRR, (void*)(uintptr_t)Samples, Count);
+
+    /* A software update event requests the first sample & restarts the sample period */
+    TIM_TypeDef* const Tim = Waveform->Timer->Instance;
+    Tim->DIER |= TIM_DIER_UDE;
+    Tim->EGR = TIM_EGR_UG;
+    Tim->CR1 |= TIM_CR1_CEN;
+    return RC_OK;
+}
+
+void Waveform_Stop(Waveform_HandleType Waveform)
+{
+    CRITICAL_SECTION_ENTER;
+    Waveform_Halt(Waveform);
+    CRITICAL_SECTION_EXIT;
+}
+
+Bool Waveform_IsBusy(Waveform_HandleType Waveform)
+{
+    return Waveform->Busy;
+}
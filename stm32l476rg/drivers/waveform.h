@@ -0,0 +1,120 @@
+/**
+ * @file waveform.h
+ *
+ * @brief Interface for the timer paced DMA-to-GPIO waveform engine.
+ *
+ *        A buffer of precomputed GPIO BSRR words is streamed into a GPIO port by DMA,
+ *        one word per update event of a timer. Each word sets & resets any pins of the
+ *        port simultaneously, edges are timed by the timer without CPU involvement.
+ */
+
+#ifndef WAVEFORM_H
+#define WAVEFORM_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "typedef.h"
+#include "dma.h"
+#include "digital.h"
+
+/* --------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Enumeration of timers able to pace a waveform, i.e. timers with an update DMA request.
+ */
+typedef enum
+{
+    WAVEFORM_TIMER_TIM2 = 0x0U,
+    WAVEFORM_TIMER_TIM3,
+    WAVEFORM_TIMER_TIM4,
+    WAVEFORM_TIMER_TIM5,
+    WAVEFORM_TIMER_TIM6,
+    WAVEFORM_TIMER_TIM7,
+    WAVEFORM_TIMER_TIM15,
+    WAVEFORM_TIMER_TIM16,
+    WAVEFORM_TIMER_TIM17,
+    WAVEFORM_TIMER_ENUM_LIMIT
+} Waveform_TimerEnum;
+
+/**
+ * @brief Opaque waveform handle type.
+ */
+typedef struct Waveform_OpaqueHandleType* Waveform_HandleType;
+
+/**
+ * @brief Waveform completion callback, invoked from interrupt context once the buffer
+ *        has been output, each pass in repeat mode.
+ * @param Waveform Waveform handle.
+ * @param Context User context given in the waveform configuration.
+ */
+typedef void (*Waveform_CallbackType)(Waveform_HandleType Waveform, void* Context);
+
+/**
+ * @brief Waveform engine configuration structure.
+ */
+typedef struct
+{
+    Waveform_TimerEnum Timer;               /* Timer pacing the samples, used exclusively. */
+    U32 SampleRate_Hz;                      /* Rate at which samples are output. */
+    const Digital_OutputType* Outputs;      /* Driven pins, all on the same port. */
+    U8 NofOutputs;
+    Dma_ChannelPriorityEnum Priority;
+    Waveform_CallbackType Callback;         /* May be NULL. */
+    void* CallbackContext;                  /* Passed to the callback. */
+} Waveform_ConfigType;
+
+/* -------------------------- Public function declarations ------------------------- */
+
+/**
+ * @brief Initialize the outputs, the timer & claim a DMA channel serving its update request.
+ * @param Config Waveform configuration.
+ * @return Handle used to interact with the waveform engine, NULL if the timer is in use,
+ *         no DMA channel is available, the outputs span several ports or the sample rate
+ *         cannot be reached.
+ */
+Waveform_HandleType Waveform_Init(const Waveform_ConfigType* Config);
+
+/**
+ * @brief Stop the given waveform engine, release its DMA channel & timer.
+ * @param Waveform Waveform handle.
+ */
+void Waveform_Deinit(Waveform_HandleType Waveform);
+
+/**
+ * @brief Start outputting the given samples, the first sample is output immediately,
+ *        each following one a sample period later.
+ * @param Waveform Waveform handle.
+ * @param Samples BSRR words, see Waveform_Sample().
+ * @param Count Number of samples.
+ * @param Repeat True = restart from the first sample upon completion until stopped.
+ * @return RC_OK = started, RC_ERROR = busy or no samples given.
+ * @note The samples must remain valid until the waveform is completed or stopped.
+ */
+ReturnCodeEnum Waveform_Start(Waveform_HandleType Waveform, const U32* Samples, U16 Count, Bool Repeat);
+
+/**
+ * @brief Stop outputting samples, the pins keep their current state.
+ * @param Waveform Waveform handle.
+ */
+void Waveform_Stop(Waveform_HandleType Waveform);
+
+/**
+ * @brief Check if the given waveform engine is outputting samples.
+ * @param Waveform Waveform handle.
+ * @return True = busy, False = idle.
+ */
+Bool Waveform_IsBusy(Waveform_HandleType Waveform);
+
+/* ------------------------- External function definitions ------------------------- */
+
+/**
+ * @brief Build a sample setting & resetting the given pins of a port, set takes precedence.
+ * @param SetMask Bit mask of pins to drive high.
+ * @param ResetMask Bit mask of pins to drive low.
+ * @return BSRR word.
+ */
+static inline U32 Waveform_Sample(U16 SetMask, U16 ResetMask)
+{
+    return ((U32)ResetMask << 16U) | (U32)SetMask;
+}
+
+#endif /* WAVEFORM_H */
@@ -125,6 +125,34 @@ void Osal_ThreadResume(S32 Id)
     }
 }
 
+Osal_ThreadHandleType Osal_GetCurrentThread(void)
+{
+    return xTaskGetCurrentTaskHandle();
+}
+
+Bool Osal_NotifyWait(U32 Timeout_ms)
+{
+    const TickType_t Ticks = (Timeout_ms == OSAL_WAIT_FOREVER) ? portMAX_DELAY : (TickType_t)Osal_msToTicks(Timeout_ms);
+    return (ulTaskNotifyTake(pdTRUE, Ticks) != 0UL);
+}
+
+void Osal_NotifyClear(void)
+{
+    (void)ulTaskNotifyTake(pdTRUE, 0UL);
+}
+
+void Osal_Notify(Osal_ThreadHandleType Thread)
+{
+    (void)xTaskNotifyGive(Thread);
+}
+
+void Osal_NotifyFromISR(Osal_ThreadHandleType Thread)
+{
+    BaseType_t HigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(Thread, &HigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(HigherPriorityTaskWoken);
+}
+
 U32 Osal_GetTickCount(void)
 {
     return (U32)xTaskGetTickCount();
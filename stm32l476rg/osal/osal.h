@@ -35,6 +35,7 @@
 
 #define OSAL_MAX_NOF_THREADS    (8U)
 #define OSAL_MAX_NOF_MUTEXES    (16U)
+#define OSAL_WAIT_FOREVER       (0xFFFFFFFFU)
 
 /* ---------------------- FreeRTOS specific OSAL functionality --------------------- */
 
@@ -52,6 +53,7 @@
 
 typedef TaskFunction_t Osal_ThreadFunc;
 typedef SemaphoreHandle_t Osal_MutexHandleType;
+typedef TaskHandle_t Osal_ThreadHandleType;
 
 
 /**
@@ -143,6 +145,41 @@ void Osal_ThreadSuspend(S32 Id);
  */
 void Osal_ThreadResume(S32 Id);
 
+/**
+ * @brief Get the handle of the calling thread, used as target of notifications.
+ * @return Thread handle.
+ */
+Osal_ThreadHandleType Osal_GetCurrentThread(void);
+
+/**
+ * @brief Block the calling thread until it is notified or the timeout elapses.
+ * @param Timeout_ms Timeout in milliseconds, OSAL_WAIT_FOREVER to wait indefinitely.
+ * @return True = notified, False = timed out.
+ */
+Bool Osal_NotifyWait(U32 Timeout_ms);
+
+/**
+ * @brief Discard a notification left pending for the calling thread.
+ */
+void Osal_NotifyClear(void);
+
+/**
+ * @brief Notify the given thread, waking it if it is blocked in Osal_NotifyWait.
+ * @param Thread Handle of thread to notify.
+ * @note Only use outside of interrupt context, not within a critical section.
+ */
+void Osal_Notify(Osal_ThreadHandleType Thread);
+
+/**
+ * @brief Notify the given thread from interrupt context, waking it if it is blocked
+ *        in Osal_NotifyWait. Requests a context switch if the woken thread has
+ *        higher priority than the interrupted one.
+ * @param Thread Handle of thread to notify.
+ * @note Only use inside of interrupt context, with priority not above the
+ *       maximum system call interrupt priority.
+ */
+void Osal_NotifyFromISR(Osal_ThreadHandleType Thread);
+
 /**
  * @brief Get the OS tick counter value.
  * @return Current OS tick count.
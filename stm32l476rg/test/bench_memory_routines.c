@@ -0,0 +1,149 @@
+/**
+ * @file bench_memory_routines.c
+ *
+ * @brief Native benchmark of the memory routines module against naive bytewise
+ *        reference implementations, for transfer sizes from 1 B to 4 KiB with
+ *        aligned & misaligned buffers.
+ *
+ * @note Host timings only indicate the relative gain of the word oriented routines,
+ *       on target the DWT cycle counter (see core_debug.h) should be used.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "memory_routines.h"
+
+/* ------------------------------- Benchmark variables ----------------------------- */
+
+#define BENCH_MIN_SIZE          (1U)
+#define BENCH_MAX_SIZE          (4096U)
+#define BENCH_BYTES_PER_RUN     (1U << 24)
+#define BENCH_MISALIGNMENT      (1U)
+
+static U8 SrcBuffer[BENCH_MAX_SIZE + 8U] ALIGN(4);
+static U8 DstBuffer[BENCH_MAX_SIZE + 8U] ALIGN(4);
+
+/**
+ * @brief Sink used to keep the compiler from discarding benchmarked calls.
+ */
+static volatile int Sink = 0;
+
+/* ----------------------------- Reference implementations ------------------------- */
+
+static void* RefMemcpy(void* Destination, const void* Source, size_t Count)
+{
+    U8* Dst = (U8*)Destination;
+    const U8* Src = (const U8*)Source;
+    while (Count--) { *Dst++ = *Src++; }
+    return Destination;
+}
+
+static void* RefMemset(void* Destination, int Data, size_t Count)
+{
+    U8* Dst = (U8*)Destination;
+    while (Count--) { *Dst++ = (U8)Data; }
+    return Destination;
+}
+
+static void* RefMemmove(void* Destination, const void* Source, size_t Count)
+{
+    U8* Dst = (U8*)Destination;
+    const U8* Src = (const U8*)Source;
+    if (Dst < Src) { while (Count--) { *Dst++ = *Src++; } }
+    else { Dst += Count; Src += Count; while (Count--) { *--Dst = *--Src; } }
+    return Destination;
+}
+
+static int RefMemcmp(const void* Lhs, const void* Rhs, size_t Count)
+{
+    const U8* L = (const U8*)Lhs;
+    const U8* R = (const U8*)Rhs;
+    for (; Count > 0U; Count--, L++, R++)
+    {
+        if (*L != *R) { return (int)*L - (int)*R; }
+    }
+    return 0;
+}
+
+/* ----------------------------------- Helpers ------------------------------------- */
+
+typedef enum
+{
+    BENCH_MEMCPY,
+    BENCH_MEMSET,
+    BENCH_MEMMOVE,
+    BENCH_MEMCMP,
+    BENCH_NOF_ROUTINES
+} BenchRoutineEnum;
+
+static const char* const RoutineNames[BENCH_NOF_ROUTINES] = { "memcpy", "memset", "memmove", "memcmp" };
+
+static double NowNs(void)
+{
+    struct timespec Ts;
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return ((double)Ts.tv_sec * 1e9) + (double)Ts.tv_nsec;
+}
+
+/**
+ * @brief Time the given routine, returns average nanoseconds per call.
+ */
+static double Bench(BenchRoutineEnum Routine, Bool Reference, U32 Size, U32 Offset)
+{
+    U8* Dst = &DstBuffer[Offset];
+    const U8* Src = &SrcBuffer[0];
+    const U32 Iterations = (BENCH_BYTES_PER_RUN / Size) + 1U;
+
+    const double Start = NowNs();
+    for (U32 i = 0; i < Iterations; i++)
+    {
+        switch (Routine)
+        {
+            case BENCH_MEMCPY:
+                Sink += *(U8*)(Reference ? RefMemcpy(Dst, Src, Size) : memcpy(Dst, Src, Size));
+                break;
+            case BENCH_MEMSET:
+                Sink += *(U8*)(Reference ? RefMemset(Dst, (int)i, Size) : memset(Dst, (int)i, Size));
+                break;
+            case BENCH_MEMMOVE:
+                /* Overlapping move within the destination buffer. */
+                Sink += *(U8*)(Reference ? RefMemmove(Dst, Dst + 4, Size) : memmove(Dst, Dst + 4, Size));
+                break;
+            case BENCH_MEMCMP:
+            default:
+                Sink += Reference ? RefMemcmp(Dst, Src, Size) : memcmp(Dst, Src, Size);
+                break;
+        }
+    }
+    return (NowNs() - Start) / (double)Iterations;
+}
+
+/* ------------------------------------ Main --------------------------------------- */
+
+int main(void)
+{
+    for (U32 i = 0; i < sizeof(SrcBuffer); i++) { SrcBuffer[i] = (U8)i; }
+
+    printf("%-8s %-10s %6s %12s %12s %8s\n", "Routine", "Alignment", "Size", "Ref [ns]", "Opt [ns]", "Speedup");
+    for (U32 Routine = 0; Routine < BENCH_NOF_ROUTINES; Routine++)
+    {
+        for (U32 Offset = 0; Offset <= BENCH_MISALIGNMENT; Offset += BENCH_MISALIGNMENT)
+        {
+            for (U32 Size = BENCH_MIN_SIZE; Size <= BENCH_MAX_SIZE; Size <<= 1)
+            {
+                /* memcmp on equal buffers walks the whole range. */
+                if (Routine == BENCH_MEMCMP) { RefMemcpy(&DstBuffer[Offset], SrcBuffer, Size); }
+
+                const double RefNs = Bench((BenchRoutineEnum)Routine, True, Size, Offset);
+                const double OptNs = Bench((BenchRoutineEnum)Routine, False, Size, Offset);
+                printf("%-8s %-10s %6u %12.2f %12.2f %7.2fx\n",
+                       RoutineNames[Routine], (Offset == 0U) ? "aligned" : "misaligned",
+                       Size, RefNs, OptNs, RefNs / OptNs);
+            }
+        }
+    }
+    return 0;
+}
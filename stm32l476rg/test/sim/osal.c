@@ -0,0 +1,49 @@
+/**
+ * @file osal.c
+ *
+ * @brief Host build of the Operating System Abstraction Layer for the peripheral simulator.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "osal.h"
+#include "sim.h"
+
+/* --------------------------------- Local variables ------------------------------- */
+static U8 MainThread;
+static volatile Bool Notified = False;
+
+/* -------------------------- Public function definitions -------------------------- */
+
+Osal_ThreadHandleType Osal_GetCurrentThread(void)
+{
+    return &MainThread;
+}
+
+Bool Osal_NotifyWait(U32 Timeout_ms)
+{
+    UNUSED(Timeout_ms);
+    Sim_ServiceInterrupts();
+    const Bool Rv = Notified;
+    Notified = False;
+    return Rv;
+}
+
+void Osal_NotifyClear(void)
+{
+    Notified = False;
+}
+
+void Osal_Notify(Osal_ThreadHandleType Thread)
+{
+    if (Thread == &MainThread) { Notified = True; }
+}
+
+void Osal_NotifyFromISR(Osal_ThreadHandleType Thread)
+{
+    if (Thread == &MainThread) { Notified = True; }
+}
+
+U32 Osal_GetTickCount(void)
+{
+    return 0U;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file osal.h
+ *
+ * @brief Host build of the Operating System Abstraction Layer for the peripheral
+ *        simulator, shadows the RTOS backed OSAL. A single thread runs, notifications
+ *        are delivered by simulated interrupts & waiting does not advance time.
+ */
+
+#ifndef OSAL_H
+#define OSAL_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "typedef.h"
+
+/* ---------------------------- Preprocessor directives ---------------------------- */
+#define OSAL_WAIT_FOREVER       (0xFFFFFFFFU)
+
+/* ------------------------------- Type definitions -------------------------------- */
+typedef void* Osal_ThreadHandleType;
+
+/* ------------------------------- Inline functions -------------------------------- */
+
+/**
+ * @brief Convert the given time in milliseconds to OS ticks, one tick per millisecond.
+ * @param Milliseconds Time in milliseconds.
+ * @return Time in OS ticks.
+ */
+static inline U32 Osal_msToTicks(U32 Milliseconds)
+{
+    return Milliseconds;
+}
+
+/**
+ * @brief Convert the given number of OS ticks into milliseconds.
+ * @param Ticks Number of ticks.
+ * @return Time in milliseconds.
+ */
+static inline U32 Osal_msFromTicks(U32 Ticks)
+{
+    return Ticks;
+}
+
+/* -------------------------- Public function declarations ------------------------- */
+
+/**
+ * @brief Get the handle of the calling thread.
+ * @return Thread handle.
+ */
+Osal_ThreadHandleType Osal_GetCurrentThread(void);
+
+/**
+ * @brief Service pending interrupts & check for a notification of the calling thread.
+ * @param Timeout_ms Unused, simulated time does not advance while waiting.
+ * @return True = notified, False = timed out.
+ */
+Bool Osal_NotifyWait(U32 Timeout_ms);
+
+/**
+ * @brief Clear pending notifications of the calling thread.
+ */
+void Osal_NotifyClear(void);
+
+/**
+ * @brief Notify the given thread.
+ * @param Thread Thread handle.
+ */
+void Osal_Notify(Osal_ThreadHandleType Thread);
+
+/**
+ * @brief Notify the given thread from interrupt context.
+ * @param Thread Thread handle.
+ */
+void Osal_NotifyFromISR(Osal_ThreadHandleType Thread);
+
+/**
+ * @brief Get the OS tick counter value.
+ * @return Current OS tick count, simulated time does not advance.
+ */
+U32 Osal_GetTickCount(void);
+
+#endif /* OSAL_H */
@@ -0,0 +1,1183 @@
+/**
+ * @file sim.c
+ *
+ * @brief Host register-level peripheral simulator.
+ *
+ *        Each register block is backed by a shared memory object mapped twice: at its
+ *        device address without access rights, trapping every access of the code under
+ *        test, & at a host chosen address the peripheral models work on. A trapped access
+ *        is single-stepped with the page made accessible, then the model of the peripheral
+ *        reacts to it, e.g. a write to a USART data register transmits the written byte.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+#define _GNU_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "sim.h"
+#include "startup.h"
+#include "irq.h"
+
+/* ------------------------- Local preprocessor definitions ------------------------ */
+#define SIM_PAGE_SIZE               (4096UL)
+#define SIM_EFLAGS_TRAP             (0x100LL)   /* x86 single-step trap flag. */
+#define SIM_PAGE_FAULT_WRITE        (0x2LL)     /* x86 page fault error code, write access. */
+#define SIM_NOF_IRQS                (82U)
+#define SIM_NOF_IRQ_WORDS           ((SIM_NOF_IRQS + 31U) / 32U)
+#define SIM_IRQ_VECTOR_OFFSET       (16U)
+#define SIM_MAX_HANDLER_RUNS        (1000000UL)
+#define SIM_MAX_DMA_ITEMS           (0x100000UL)
+#define SIM_MIN_HOST_ADDRESS        (0x10000UL)
+#define SIM_PPB_BASE                (0xE0000000UL)
+#define SIM_NOF_USARTS              (6U)
+#define SIM_NOF_DMAS                (2U)
+#define SIM_NOF_DMA_CHANNELS        (7U)
+#define SIM_NOF_GPIO_PORTS          (8U)
+#define SIM_DMA_CHANNEL_STRIDE      (0x14U)
+#define SIM_USART_ICR_MASK          (USART_ICR_PECF | USART_ICR_FECF | USART_ICR_NECF | USART_ICR_ORECF | \
+                                     USART_ICR_IDLECF | USART_ICR_TCCF | USART_ICR_LBDCF | USART_ICR_CTSCF | \
+                                     USART_ICR_RTOCF | USART_ICR_EOBCF | USART_ICR_CMCF | USART_ICR_WUCF)
+
+/*  -------------------------- Structures & enumerations --------------------------- */
+
+/**
+ * @brief Address range of simulated registers & its two mappings.
+ */
+typedef struct
+{
+    uintptr_t Base;     /* Device address, trapping view. */
+    size_t Size;
+    U8* Alias;          /* Model view. */
+} Sim_RegionType;
+
+/**
+ * @brief Register access trapped by the simulator.
+ */
+typedef struct
+{
+    uintptr_t Address;
+    Bool IsWrite;
+    U32 Size;           /* Number of bytes written. */
+    U32 OldValue;       /* Register word before the access. */
+} Sim_AccessType;
+
+/**
+ * @brief Internal state of a DMA channel, latched when the channel is enabled.
+ */
+typedef struct
+{
+    Bool Active;
+    U32 Peripheral;     /* Current peripheral address. */
+    U32 Memory;         /* Current memory address. */
+    U16 Count;          /* Number of data items programmed. */
+} Sim_DmaChannelStateType;
+
+/**
+ * @brief USART DMA request routed to a DMA channel by a request selection.
+ */
+typedef struct
+{
+    U8 Dma;
+    U8 Channel;
+    U8 Selection;
+    U8 Usart;
+    Bool Receive;
+} Sim_DmaRouteType;
+
+/**
+ * @brief Transmit shift register of a USART, only modelled with a character delay.
+ */
+typedef struct
+{
+    Bool Delayed;       /* Characters take one idle step to shift out. */
+    Bool Shifting;      /* Shift register holds a character. */
+    U8 Data;
+} Sim_ShifterType;
+
+/**
+ * @brief Data transmitted by a USART & not yet read by the test.
+ */
+typedef struct
+{
+    U8 Data[SIM_USART_CAPTURE_SIZE];
+    U32 Count;
+} Sim_CaptureType;
+
+/* --------------------------------- Local variables ------------------------------- */
+static Sim_RegionType SimRegions[] =
+{
+    { PERIPH_BASE,     0x30000UL,  NULL },   /* APB1, APB2 & AHB1 peripherals. */
+    { AHB2PERIPH_BASE, 0x2000UL,   NULL },   /* GPIO ports. */
+    { SIM_PPB_BASE,    0x100000UL, NULL },   /* Private peripheral bus. */
+};
+
+static USART_TypeDef* const SimUsarts[SIM_NOF_USARTS] = { USART1, USART2, USART3, UART4, UART5, LPUART1 };
+static const IRQn_Type SimUsartIrqs[SIM_NOF_USARTS] =
+{
+    USART1_IRQn, USART2_IRQn, USART3_IRQn, UART4_IRQn, UART5_IRQn, LPUART1_IRQn
+};
+
+static DMA_TypeDef* const SimDmas[SIM_NOF_DMAS] = { DMA1, DMA2 };
+static DMA_Request_TypeDef* const SimDmaRequests[SIM_NOF_DMAS] = { DMA1_CSELR, DMA2_CSELR };
+static DMA_Channel_TypeDef* const SimDmaChannels[SIM_NOF_DMAS][SIM_NOF_DMA_CHANNELS] =
+{
+    { DMA1_Channel1, DMA1_Channel2, DMA1_Channel3, DMA1_Channel4, DMA1_Channel5, DMA1_Channel6, DMA1_Channel7 },
+    { DMA2_Channel1, DMA2_Channel2, DMA2_Channel3, DMA2_Channel4, DMA2_Channel5, DMA2_Channel6, DMA2_Channel7 }
+};
+static const IRQn_Type SimDmaIrqs[SIM_NOF_DMAS][SIM_NOF_DMA_CHANNELS] =
+{
+    { DMA1_Channel1_IRQn, DMA1_Channel2_IRQn, DMA1_Channel3_IRQn, DMA1_Channel4_IRQn,
+      DMA1_Channel5_IRQn, DMA1_Channel6_IRQn, DMA1_Channel7_IRQn },
+    { DMA2_Channel1_IRQn, DMA2_Channel2_IRQn, DMA2_Channel3_IRQn, DMA2_Channel4_IRQn,
+      DMA2_Channel5_IRQn, DMA2_Channel6_IRQn, DMA2_Channel7_IRQn }
+};
+
+/**
+ * @brief USART requests of the DMA request mapping in RM0351, DMA & channel zero based.
+ */
+static const Sim_DmaRouteType SimDmaRoutes[] =
+{
+    { 0U, 4U, 2U, 0U, True  }, { 0U, 3U, 2U, 0U, False },     /* USART1 */
+    { 1U, 6U, 2U, 0U, True  }, { 1U, 5U, 2U, 0U, False },
+    { 0U, 5U, 2U, 1U, True  }, { 0U, 6U, 2U, 1U, False },     /* USART2 */
+    { 0U, 2U, 2U, 2U, True  }, { 0U, 1U, 2U, 2U, False },     /* USART3 */
+    { 1U, 4U, 2U, 3U, True  }, { 1U, 2U, 2U, 3U, False },     /* UART4 */
+    { 1U, 1U, 2U, 4U, True  }, { 1U, 0U, 2U, 4U, False },     /* UART5 */
+    { 1U, 6U, 4U, 5U, True  }, { 1U, 5U, 4U, 5U, False },     /* LPUART1 */
+};
+
+static GPIO_TypeDef* const SimGpioPorts[SIM_NOF_GPIO_PORTS] = { GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG, GPIOH };
+
+static Sim_AccessType SimAccess;
+static Sim_DmaChannelStateType SimDmaStates[SIM_NOF_DMAS][SIM_NOF_DMA_CHANNELS];
+static Sim_CaptureType SimCaptures[SIM_NOF_USARTS];
+static Sim_ShifterType SimShifters[SIM_NOF_USARTS];
+static U16 SimGpioInputs[SIM_NOF_GPIO_PORTS];
+static U16 SimGpioDriven[SIM_NOF_GPIO_PORTS];
+static U32 SimCrc;
+static U32 SimNvicEnabled[SIM_NOF_IRQ_WORDS];
+static U32 SimNvicPending[SIM_NOF_IRQ_WORDS];
+static Bool SimIrqMasked = False;
+static Bool SimInHandler = False;
+static Bool SimDmaServicing = False;
+static Bool SimExclusive = False;
+static U32 SimNofAccesses = 0U;
+static U32 SimCoreClock_Hz = SIM_DEFAULT_CORE_CLOCK_Hz;
+static U32 SimCycleBase = 0U;
+static struct timespec SimCycleBaseTime;
+
+/* Vector table of the target image, left empty, see Irq_Init() */
+VectorTableType VectorTable;
+
+/* ------------------------- Private function declarations ------------------------- */
+
+/**
+ * @brief Get the model view of the given device address.
+ * @param Address Device address.
+ * @return Model view address, NULL if the address is not simulated.
+ */
+static void* Sim_Alias(volatile const void* Address);
+
+/**
+ * @brief Dispatch a register access to the model of the accessed peripheral.
+ * @param Access Register access.
+ */
+static void Sim_PeripheralAccess(const Sim_AccessType* Access);
+
+/**
+ * @brief Read a data item on behalf of a DMA channel.
+ * @param Address Device or host address.
+ * @param Size Number of bytes.
+ * @param Value Read data.
+ * @return True = read, False = bus error.
+ */
+static Bool Sim_BusRead(U32 Address, U32 Size, U32* Value);
+
+/**
+ * @brief Write a data item on behalf of a DMA channel.
+ * @param Address Device or host address.
+ * @param Size Number of bytes.
+ * @param Value Data to write.
+ * @return True = written, False = bus error.
+ */
+static Bool Sim_BusWrite(U32 Address, U32 Size, U32 Value);
+
+/**
+ * @brief Serve the active requests of all DMA channels.
+ */
+static void Sim_DmaService(void);
+
+/* -------------------------- Private function definitions ------------------------- */
+
+static void* Sim_Alias(volatile const void* Address)
+{
+    const uintptr_t Addr = (uintptr_t)Address;
+    for (U32 i = 0; i < (sizeof(SimRegions) / sizeof(SimRegions[0])); i++)
+    {
+        if ( (Addr >= SimRegions[i].Base) && (Addr < (SimRegions[i].Base + SimRegions[i].Size)) )
+        {
+            return &SimRegions[i].Alias[Addr - SimRegions[i].Base];
+        }
+    }
+    return NULL;
+}
+
+#define SIM_REGS(Type, Instance)    ((Type*)Sim_Alias(Instance))
+
+/**
+ * @brief Read a register word of the model view, not trapped.
+ * @param Address Device address.
+ * @return Register value.
+ */
+static inline U32 Sim_ReadWord(uintptr_t Address)
+{
+    return *(volatile U32*)Sim_Alias((const void*)(Address & ~(uintptr_t)3U));
+}
+
+/**
+ * @brief Determine the number of bytes stored by the x86-64 instruction at the given address,
+ *        sufficient for the moves & read-modify-write instructions compilers emit.
+ * @param Code Instruction address.
+ * @return Number of bytes stored.
+ */
+static U32 Sim_DecodeStoreSize(const U8* Code)
+{
+    U32 Size = 4U;
+    for (;;)
+    {
+        const U8 Prefix = *Code;
+        if (Prefix == 0x66U) { Size = 2U; Code++; }
+        else if ( (Prefix == 0xF0U) || (Prefix == 0xF2U) || (Prefix == 0xF3U) || (Prefix == 0x2EU) ||
+                  (Prefix == 0x3EU) || (Prefix == 0x26U) || (Prefix == 0x36U) || (Prefix == 0x64U) ||
+                  (Prefix == 0x65U) || (Prefix == 0x67U) ) { Code++; }
+        else { break; }
+    }
+    if ((*Code & 0xF0U) == 0x40U)
+    {
+        if (*Code & 0x08U) { Size = 8U; }
+        Code++;
+    }
+    switch (*Code)
+    {
+        case 0x00U: case 0x08U: case 0x20U: case 0x28U: case 0x30U:
+        case 0x80U: case 0x86U: case 0x88U: case 0xC6U: case 0xFEU: { return 1U; }
+        default: { return Size; }
+    }
+}
+
+/**
+ * @brief Set or clear the bit of the given interrupt in an NVIC bit map.
+ * @param Map Bit map.
+ * @param Irq Interrupt number.
+ * @param Set True = set, False = clear.
+ */
+static inline void Sim_NvicBit(U32* Map, IRQn_Type Irq, Bool Set)
+{
+    if (Set) { Map[(U32)Irq >> 5U] |= (1UL << ((U32)Irq & 0x1FU)); }
+    else     { Map[(U32)Irq >> 5U] &= ~(1UL << ((U32)Irq & 0x1FU)); }
+}
+
+/**
+ * @brief Mirror the NVIC enable & pending state to the registers.
+ */
+static void Sim_NvicPublish(void)
+{
+    NVIC_Type* const Regs = SIM_REGS(NVIC_Type, NVIC);
+    for (U32 i = 0; i < SIM_NOF_IRQ_WORDS; i++)
+    {
+        Regs->ISER[i] = SimNvicEnabled[i];
+        Regs->ICER[i] = SimNvicEnabled[i];
+        Regs->ISPR[i] = SimNvicPending[i];
+        Regs->ICPR[i] = SimNvicPending[i];
+    }
+}
+
+/* ---------------------------------- NVIC model ----------------------------------- */
+
+static void Sim_NvicAccess(const Sim_AccessType* Access)
+{
+    if (!Access->IsWrite) { return; }
+
+    NVIC_Type* const Regs = SIM_REGS(NVIC_Type, NVIC);
+    const uintptr_t Offset = Access->Address - NVIC_BASE;
+    const U32 Word = (U32)((Offset & 0x7FU) >> 2U);
+    if (Word >= SIM_NOF_IRQ_WORDS) { return; }
+
+    if      (Offset < 0x080U) { SimNvicEnabled[Word] |= Regs->ISER[Word]; }
+    else if (Offset < 0x100U) { SimNvicEnabled[Word] &= ~Regs->ICER[Word]; }
+    else if (Offset < 0x180U) { SimNvicPending[Word] |= Regs->ISPR[Word]; }
+    else if (Offset < 0x200U) { SimNvicPending[Word] &= ~Regs->ICPR[Word]; }
+    else { return; }
+    Sim_NvicPublish();
+}
+
+/* ---------------------------------- RCC model ------------------------------------ */
+
+static void Sim_RccAccess(const Sim_AccessType* Access)
+{
+    if (!Access->IsWrite) { return; }
+
+    RCC_TypeDef* const Regs = SIM_REGS(RCC_TypeDef, RCC);
+    static const U32 ReadyFlags[][2] =
+    {
+        { RCC_CR_MSION,     RCC_CR_MSIRDY     },
+        { RCC_CR_HSION,     RCC_CR_HSIRDY     },
+        { RCC_CR_HSEON,     RCC_CR_HSERDY     },
+        { RCC_CR_PLLON,     RCC_CR_PLLRDY     },
+        { RCC_CR_PLLSAI1ON, RCC_CR_PLLSAI1RDY },
+        { RCC_CR_PLLSAI2ON, RCC_CR_PLLSAI2RDY },
+    };
+    for (U32 i = 0; i < (sizeof(ReadyFlags) / sizeof(ReadyFlags[0])); i++)
+    {
+        if (Regs->CR & ReadyFlags[i][0]) { Regs->CR |= ReadyFlags[i][1]; }
+        else                             { Regs->CR &= ~ReadyFlags[i][1]; }
+    }
+    const U32 Switch = (Regs->CFGR & RCC_CFGR_SW_Msk) >> RCC_CFGR_SW_Pos;
+    Regs->CFGR = (Regs->CFGR & ~RCC_CFGR_SWS_Msk) | (Switch << RCC_CFGR_SWS_Pos);
+    if (Regs->BDCR & RCC_BDCR_LSEON) { Regs->BDCR |= RCC_BDCR_LSERDY; }
+    else                             { Regs->BDCR &= ~RCC_BDCR_LSERDY; }
+    if (Regs->CSR & RCC_CSR_LSION)   { Regs->CSR |= RCC_CSR_LSIRDY; }
+    else                             { Regs->CSR &= ~RCC_CSR_LSIRDY; }
+}
+
+/* ---------------------------------- GPIO model ----------------------------------- */
+
+/**
+ * @brief Update the input data register of a port from its outputs, driven inputs & pulls.
+ * @param Port Port index.
+ */
+static void Sim_GpioUpdateInputs(U32 Port)
+{
+    GPIO_TypeDef* const Regs = SIM_REGS(GPIO_TypeDef, SimGpioPorts[Port]);
+    U32 Idr = 0U;
+    for (U32 Pin = 0; Pin < 16U; Pin++)
+    {
+        const U32 Mode = (Regs->MODER >> (Pin << 1U)) & 0x3U;
+        const U32 Pull = (Regs->PUPDR >> (Pin << 1U)) & 0x3U;
+        U32 Level;
+        if (Mode == 0x1U)                          { Level = (Regs->ODR >> Pin) & 0x1U; }
+        else if (SimGpioDriven[Port] & (1U << Pin)) { Level = (SimGpioInputs[Port] >> Pin) & 0x1U; }
+        else                                       { Level = (Pull == 0x1U) ? 1U : 0U; }
+        Idr |= (Level << Pin);
+    }
+    Regs->IDR = Idr;
+}
+
+static void Sim_GpioAccess(U32 Port, const Sim_AccessType* Access)
+{
+    if (!Access->IsWrite) { return; }
+
+    GPIO_TypeDef* const Regs = SIM_REGS(GPIO_TypeDef, SimGpioPorts[Port]);
+    switch (Access->Address & 0x3FCU)
+    {
+        case offsetof(GPIO_TypeDef, IDR):
+        {
+            Regs->IDR = Access->OldValue;
+            break;
+        }
+        case offsetof(GPIO_TypeDef, BSRR):
+        {
+            const U32 Bsrr = Regs->BSRR;
+            Regs->ODR = (Regs->ODR & ~(Bsrr >> 16U)) | (Bsrr & 0xFFFFU);
+            Regs->BSRR = 0U;
+            break;
+        }
+        case offsetof(GPIO_TypeDef, BRR):
+        {
+            Regs->ODR &= ~(Regs->BRR & 0xFFFFU);
+            Regs->BRR = 0U;
+            break;
+        }
+        default: { break; }
+    }
+    Regs->ODR &= 0xFFFFU;
+    Sim_GpioUpdateInputs(Port);
+}
+
+/* ---------------------------------- CRC model ------------------------------------ */
+
+/**
+ * @brief Reverse the bit order within each group of the given width.
+ * @param Value Value to reverse.
+ * @param Bits Number of valid bits in the value.
+ * @param Group Width of the groups reversed, at most the number of valid bits.
+ * @return Reversed value.
+ */
+static U32 Sim_ReverseBits(U32 Value, U32 Bits, U32 Group)
+{
+    U32 Rv = 0U;
+    for (U32 Bit = 0; Bit < Bits; Bit++)
+    {
+        const U32 Base = Bit - (Bit % Group);
+        const U32 Mirror = Base + (Group - 1U - (Bit - Base));
+        Rv |= ((Value >> Bit) & 0x1U) << Mirror;
+    }
+    return Rv;
+}
+
+/**
+ * @brief Get the CRC polynomial size configured in the given control register.
+ * @param Cr CRC control register.
+ * @return Polynomial size in bits.
+ */
+static U32 Sim_CrcWidth(U32 Cr)
+{
+    static const U32 Widths[] = { 32U, 16U, 8U, 7U };
+    return Widths[(Cr & CRC_CR_POLYSIZE_Msk) >> CRC_CR_POLYSIZE_Pos];
+}
+
+/**
+ * @brief Publish the CRC, output reversal applied, to the data register.
+ * @param Regs CRC registers, model view.
+ */
+static void Sim_CrcPublish(CRC_TypeDef* Regs)
+{
+    const U32 Width = Sim_CrcWidth(Regs->CR);
+    Regs->DR = (Regs->CR & CRC_CR_REV_OUT) ? Sim_ReverseBits(SimCrc, Width, Width) : SimCrc;
+}
+
+static void Sim_CrcAccess(const Sim_AccessType* Access)
+{
+    if (!Access->IsWrite) { return; }
+
+    CRC_TypeDef* const Regs = SIM_REGS(CRC_TypeDef, CRC);
+    const U32 Width = Sim_CrcWidth(Regs->CR);
+    const U32 Mask = (Width == 32U) ? 0xFFFFFFFFUL : ((1UL << Width) - 1U);
+    switch (Access->Address & 0x3FCU)
+    {
+        case offsetof(CRC_TypeDef, DR):
+        {
+            const U32 Bits = Access->Size * 8U;
+            U32 Data = 0U;
+            memcpy(&Data, Sim_Alias((const void*)Access->Address), Access->Size);
+            static const U32 InputGroups[] = { 0U, 8U, 16U, 32U };
+            const U32 Group = InputGroups[(Regs->CR & CRC_CR_REV_IN_Msk) >> CRC_CR_REV_IN_Pos];
+            if (Group != 0U) { Data = Sim_ReverseBits(Data, Bits, (Group < Bits) ? Group : Bits); }
+
+            for (U32 i = Bits; i > 0U; i--)
+            {
+                const U32 Feedback = ((SimCrc >> (Width - 1U)) ^ (Data >> (i - 1U))) & 0x1U;
+                SimCrc = (SimCrc << 1U) & Mask;
+                if (Feedback) { SimCrc ^= (Regs->POL & Mask); }
+            }
+            Sim_CrcPublish(Regs);
+            break;
+        }
+        case offsetof(CRC_TypeDef, CR):
+        {
+            if (Regs->CR & CRC_CR_RESET)
+            {
+                SimCrc = Regs->INIT & Mask;
+                Regs->CR &= ~CRC_CR_RESET;
+            }
+            Sim_CrcPublish(Regs);
+            break;
+        }
+        default: { break; }
+    }
+}
+
+/* ---------------------------------- USART model ---------------------------------- */
+
+/**
+ * @brief Check if the interrupt line of the given USART is asserted.
+ * @param Regs USART registers, model view.
+ * @return True = asserted, False = deasserted.
+ */
+static Bool Sim_UsartIrqLevel(const USART_TypeDef* Regs)
+{
+    const U32 Isr = Regs->ISR;
+    const U32 Cr1 = Regs->CR1;
+    const U32 Cr3 = Regs->CR3;
+    return ( ((Isr & USART_ISR_TXE) && (Cr1 & USART_CR1_TXEIE)) ||
+             ((Isr & USART_ISR_TC) && (Cr1 & USART_CR1_TCIE)) ||
+             ((Isr & (USART_ISR_RXNE | USART_ISR_ORE)) && (Cr1 & USART_CR1_RXNEIE)) ||
+             ((Isr & USART_ISR_IDLE) && (Cr1 & USART_CR1_IDLEIE)) ||
+             ((Isr & USART_ISR_PE) && (Cr1 & USART_CR1_PEIE)) ||
+             ((Isr & USART_ISR_CMF) && (Cr1 & USART_CR1_CMIE)) ||
+             ((Isr & (USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE)) && (Cr3 & USART_CR3_EIE)) ||
+             ((Isr & USART_ISR_WUF) && (Cr3 & USART_CR3_WUFIE)) );
+}
+
+/**
+ * @brief Check if the given USART requests a DMA transfer.
+ * @param Usart USART index.
+ * @param Receive True = reception request, False = transmission request.
+ * @return True = requested, False = not requested.
+ */
+static Bool Sim_UsartDmaRequest(U32 Usart, Bool Receive)
+{
+    const USART_TypeDef* const Regs = SIM_REGS(USART_TypeDef, SimUsarts[Usart]);
+    if (Receive) { return (Regs->CR3 & USART_CR3_DMAR) && (Regs->ISR & USART_ISR_RXNE); }
+    return (Regs->CR3 & USART_CR3_DMAT) && (Regs->ISR & USART_ISR_TXE) &&
+           (Regs->CR1 & USART_CR1_UE) && (Regs->CR1 & USART_CR1_TE);
+}
+
+/**
+ * @brief Append a character to the data transmitted by the given USART.
+ * @param Usart USART index.
+ * @param Data Transmitted character.
+ */
+static void Sim_UsartCapture(U32 Usart, U8 Data)
+{
+    Sim_CaptureType* const Capture = &SimCaptures[Usart];
+    if (Capture->Count < SIM_USART_CAPTURE_SIZE) { Capture->Data[Capture->Count++] = Data; }
+}
+
+/**
+ * @brief Let one character time pass on the USARTs with a character delay: the character
+ *        in the shift register leaves the line & the data register refills the shift register.
+ */
+static void Sim_UsartShift(void)
+{
+    for (U32 i = 0; i < SIM_NOF_USARTS; i++)
+    {
+        Sim_ShifterType* const Shifter = &SimShifters[i];
+        if (!Shifter->Shifting) { continue; }
+
+        USART_TypeDef* const Regs = SIM_REGS(USART_TypeDef, SimUsarts[i]);
+        Sim_UsartCapture(i, Shifter->Data);
+        if (Regs->ISR & USART_ISR_TXE)
+        {
+            Shifter->Shifting = False;
+            Regs->ISR |= USART_ISR_TC;
+        }
+        else
+        {
+            Shifter->Data = (U8)Regs->TDR;
+            Regs->ISR |= USART_ISR_TXE;
+        }
+    }
+}
+
+static void Sim_UsartAccess(U32 Usart, const Sim_AccessType* Access)
+{
+    USART_TypeDef* const Regs = SIM_REGS(USART_TypeDef, SimUsarts[Usart]);
+    switch (Access->Address & 0x3FCU)
+    {
+        case offsetof(USART_TypeDef, CR1):
+        {
+            if (!Access->IsWrite) { break; }
+            const U32 Cr1 = Regs->CR1;
+            if ( (Cr1 & USART_CR1_UE) && (Cr1 & USART_CR1_TE) ) { Regs->ISR |= USART_ISR_TEACK; }
+            else                                                 { Regs->ISR &= ~USART_ISR_TEACK; }
+            if ( (Cr1 & USART_CR1_UE) && (Cr1 & USART_CR1_RE) ) { Regs->ISR |= USART_ISR_REACK; }
+            else                                                 { Regs->ISR &= ~USART_ISR_REACK; }
+            break;
+        }
+        case offsetof(USART_TypeDef, ISR):
+        {
+            if (Access->IsWrite) { Regs->ISR = Access->OldValue; }
+            break;
+        }
+        case offsetof(USART_TypeDef, ICR):
+        {
+            if (!Access->IsWrite) { break; }
+            Regs->ISR &= ~(Regs->ICR & SIM_USART_ICR_MASK);
+            Regs->ICR = 0U;
+            break;
+        }
+        case offsetof(USART_TypeDef, RQR):
+        {
+            if (!Access->IsWrite) { break; }
+            if (Regs->RQR & USART_RQR_RXFRQ) { Regs->ISR &= ~USART_ISR_RXNE; }
+            if (Regs->RQR & USART_RQR_TXFRQ) { Regs->ISR |= USART_ISR_TXE; }
+            Regs->RQR = 0U;
+            break;
+        }
+        case offsetof(USART_TypeDef, RDR):
+        {
+            if (Access->IsWrite) { Regs->RDR = Access->OldValue; }
+            else                 { Regs->ISR &= ~USART_ISR_RXNE; }
+            break;
+        }
+        case offsetof(USART_TypeDef, TDR):
+        {
+            if ( !Access->IsWrite || !(Regs->CR1 & USART_CR1_UE) || !(Regs->CR1 & USART_CR1_TE) ) { break; }
+            Sim_ShifterType* const Shifter = &SimShifters[Usart];
+            if (!Shifter->Delayed)
+            {
+                /* Shifted out at once, the data register is empty again */
+                Sim_UsartCapture(Usart, (U8)Regs->TDR);
+                Regs->ISR |= (USART_ISR_TXE | USART_ISR_TC);
+            }
+            else if (!Shifter->Shifting)
+            {
+                Shifter->Data = (U8)Regs->TDR;
+                Shifter->Shifting = True;
+                Regs->ISR &= ~USART_ISR_TC;
+            }
+            else
+            {
+                /* Held until the shift register is free, a full data register is overwritten */
+                Regs->ISR &= ~(USART_ISR_TXE | USART_ISR_TC);
+            }
+            break;
+        }
+        default: { break; }
+    }
+}
+
+/* ----------------------------------- DMA model ----------------------------------- */
+
+/**
+ * @brief Check if the interrupt line of the given DMA channel is asserted.
+ * @param Dma DMA index.
+ * @param Channel Channel index.
+ * @return True = asserted, False = deasserted.
+ */
+static Bool Sim_DmaIrqLevel(U32 Dma, U32 Channel)
+{
+    const U32 Flags = SIM_REGS(DMA_TypeDef, SimDmas[Dma])->ISR >> (Channel * 4U);
+    const U32 Ccr = SIM_REGS(DMA_Channel_TypeDef, SimDmaChannels[Dma][Channel])->CCR;
+    return ( ((Flags & DMA_ISR_TCIF1) && (Ccr & DMA_CCR_TCIE)) ||
+             ((Flags & DMA_ISR_HTIF1) && (Ccr & DMA_CCR_HTIE)) ||
+             ((Flags & DMA_ISR_TEIF1) && (Ccr & DMA_CCR_TEIE)) );
+}
+
+/**
+ * @brief Check if the given DMA channel has a transfer requested.
+ * @param Dma DMA index.
+ * @param Channel Channel index.
+ * @return True = requested, False = idle.
+ */
+static Bool Sim_DmaChannelRequest(U32 Dma, U32 Channel)
+{
+    const DMA_Channel_TypeDef* const Regs = SIM_REGS(DMA_Channel_TypeDef, SimDmaChannels[Dma][Channel]);
+    if ( !SimDmaStates[Dma][Channel].Active || (Regs->CNDTR == 0U) ) { return False; }
+    if (Regs->CCR & DMA_CCR_MEM2MEM) { return !(Regs->CCR & DMA_CCR_CIRC); }
+
+    const U32 Selection = (SIM_REGS(DMA_Request_TypeDef, SimDmaRequests[Dma])->CSELR >> (Channel * 4U)) & 0xFU;
+    for (U32 i = 0; i < (sizeof(SimDmaRoutes) / sizeof(SimDmaRoutes[0])); i++)
+    {
+        const Sim_DmaRouteType* const Route = &SimDmaRoutes[i];
+        if ( (Route->Dma == Dma) && (Route->Channel == Channel) && (Route->Selection == Selection) )
+        {
+            return Sim_UsartDmaRequest(Route->Usart, Route->Receive);
+        }
+    }
+    return False;
+}
+
+/**
+ * @brief Transfer one data item on the given DMA channel & update its counter & flags.
+ * @param Dma DMA index.
+ * @param Channel Channel index.
+ */
+static void Sim_DmaTransferItem(U32 Dma, U32 Channel)
+{
+    DMA_TypeDef* const Regs = SIM_REGS(DMA_TypeDef, SimDmas[Dma]);
+    DMA_Channel_TypeDef* const ChRegs = SIM_REGS(DMA_Channel_TypeDef, SimDmaChannels[Dma][Channel]);
+    Sim_DmaChannelStateType* const State = &SimDmaStates[Dma][Channel];
+    const U32 Ccr = ChRegs->CCR;
+    const U32 PeripheralSize = 1UL << ((Ccr & DMA_CCR_PSIZE_Msk) >> DMA_CCR_PSIZE_Pos);
+    const U32 MemorySize = 1UL << ((Ccr & DMA_CCR_MSIZE_Msk) >> DMA_CCR_MSIZE_Pos);
+    const U32 Shift = Channel * 4U;
+
+    U32 Value;
+    const Bool FromMemory = (Ccr & DMA_CCR_DIR) != 0U;
+    const Bool Ok = FromMemory ?
+        (Sim_BusRead(State->Memory, MemorySize, &Value) && Sim_BusWrite(State->Peripheral, PeripheralSize, Value)) :
+        (Sim_BusRead(State->Peripheral, PeripheralSize, &Value) && Sim_BusWrite(State->Memory, MemorySize, Value));
+    if (!Ok)
+    {
+        ChRegs->CCR &= ~DMA_CCR_EN;
+        State->Active = False;
+        Regs->ISR |= ((DMA_ISR_GIF1 | DMA_ISR_TEIF1) << Shift);
+        return;
+    }
+
+    if (Ccr & DMA_CCR_PINC) { State->Peripheral += PeripheralSize; }
+    if (Ccr & DMA_CCR_MINC) { State->Memory += MemorySize; }
+    ChRegs->CNDTR--;
+    if (ChRegs->CNDTR == (State->Count / 2U)) { Regs->ISR |= ((DMA_ISR_GIF1 | DMA_ISR_HTIF1) << Shift); }
+    if (ChRegs->CNDTR == 0U)
+    {
+        Regs->ISR |= ((DMA_ISR_GIF1 | DMA_ISR_TCIF1) << Shift);
+        if (Ccr & DMA_CCR_CIRC)
+        {
+            ChRegs->CNDTR = State->Count;
+            State->Peripheral = ChRegs->CPAR;
+            State->Memory = ChRegs->CMAR;
+        }
+    }
+}
+
+static void Sim_DmaAccess(U32 Dma, const Sim_AccessType* Access)
+{
+    if (!Access->IsWrite) { return; }
+
+    DMA_TypeDef* const Regs = SIM_REGS(DMA_TypeDef, SimDmas[Dma]);
+    const U32 Offset = (U32)(Access->Address & 0x3FCU);
+    if (Offset == offsetof(DMA_TypeDef, ISR))
+    {
+        Regs->ISR = Access->OldValue;
+    }
+    else if (Offset == offsetof(DMA_TypeDef, IFCR))
+    {
+        const U32 Ifcr = Regs->IFCR;
+        for (U32 Channel = 0; Channel < SIM_NOF_DMA_CHANNELS; Channel++)
+        {
+            /* Clearing the global flag clears all flags of the channel */
+            if (Ifcr & (DMA_IFCR_CGIF1 << (Channel * 4U))) { Regs->ISR &= ~(0xFUL << (Channel * 4U)); }
+        }
+        Regs->ISR &= ~Ifcr;
+        Regs->IFCR = 0U;
+    }
+    else if ( (Offset >= 0x08U) && (Offset < (0x08U + (SIM_NOF_DMA_CHANNELS * SIM_DMA_CHANNEL_STRIDE))) &&
+              (((Offset - 0x08U) % SIM_DMA_CHANNEL_STRIDE) == 0U) )
+    {
+        const U32 Channel = (Offset - 0x08U) / SIM_DMA_CHANNEL_STRIDE;
+        const DMA_Channel_TypeDef* const ChRegs = SIM_REGS(DMA_Channel_TypeDef, SimDmaChannels[Dma][Channel]);
+        Sim_DmaChannelStateType* const State = &SimDmaStates[Dma][Channel];
+        if ( (ChRegs->CCR & DMA_CCR_EN) && !(Access->OldValue & DMA_CCR_EN) )
+        {
+            State->Active = True;
+            State->Peripheral = ChRegs->CPAR;
+            State->Memory = ChRegs->CMAR;
+            State->Count = (U16)ChRegs->CNDTR;
+        }
+        else if (!(ChRegs->CCR & DMA_CCR_EN))
+        {
+            State->Active = False;
+        }
+    }
+}
+
+static void Sim_DmaService(void)
+{
+    if (SimDmaServicing) { return; }
+    SimDmaServicing = True;
+
+    U32 NofItems = 0U;
+    Bool Progress;
+    do
+    {
+        Progress = False;
+        for (U32 Dma = 0; Dma < SIM_NOF_DMAS; Dma++)
+        {
+            for (U32 Channel = 0; Channel < SIM_NOF_DMA_CHANNELS; Channel++)
+            {
+                while ( Sim_DmaChannelRequest(Dma, Channel) && (NofItems < SIM_MAX_DMA_ITEMS) )
+                {
+                    Sim_DmaTransferItem(Dma, Channel);
+                    NofItems++;
+                    Progress = True;
+                }
+            }
+        }
+    } while (Progress && (NofItems < SIM_MAX_DMA_ITEMS));
+
+    SimDmaServicing = False;
+}
+
+/* ------------------------------------ Bus access --------------------------------- */
+
+static Bool Sim_BusRead(U32 Address, U32 Size, U32* Value)
+{
+    void* const Alias = Sim_Alias((const void*)(uintptr_t)Address);
+    *Value = 0U;
+    if (Alias != NULL)
+    {
+        memcpy(Value, Alias, Size);
+        const Sim_AccessType Access = { Address, False, Size, Sim_ReadWord(Address) };
+        Sim_PeripheralAccess(&Access);
+        return True;
+    }
+    if (Address < SIM_MIN_HOST_ADDRESS) { return False; }
+    memcpy(Value, (const void*)(uintptr_t)Address, Size);
+    return True;
+}
+
+static Bool Sim_BusWrite(U32 Address, U32 Size, U32 Value)
+{
+    void* const Alias = Sim_Alias((const void*)(uintptr_t)Address);
+    if (Alias != NULL)
+    {
+        const Sim_AccessType Access = { Address, True, Size, Sim_ReadWord(Address) };
+        memcpy(Alias, &Value, Size);
+        Sim_PeripheralAccess(&Access);
+        return True;
+    }
+    if (Address < SIM_MIN_HOST_ADDRESS) { return False; }
+    memcpy((void*)(uintptr_t)Address, &Value, Size);
+    return True;
+}
+
+/* ------------------------------ Core & access dispatch --------------------------- */
+
+/**
+ * @brief Update the DWT cycle counter from host time.
+ */
+static void Sim_UpdateCycleCounter(void)
+{
+    DWT_Type* const Regs = SIM_REGS(DWT_Type, DWT);
+    struct timespec Now;
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    const double Elapsed_s = (double)(Now.tv_sec - SimCycleBaseTime.tv_sec) +
+                             ((double)(Now.tv_nsec - SimCycleBaseTime.tv_nsec) * 1.0e-9);
+    if (Regs->CTRL & DWT_CTRL_CYCCNTENA_Msk)
+    {
+        Regs->CYCCNT = SimCycleBase + (U32)(U64)(Elapsed_s * (double)SimCoreClock_Hz);
+    }
+    else
+    {
+        SimCycleBase = Regs->CYCCNT;
+        SimCycleBaseTime = Now;
+    }
+}
+
+static void Sim_PeripheralAccess(const Sim_AccessType* Access)
+{
+    const uintptr_t Address = Access->Address;
+    for (U32 i = 0; i < SIM_NOF_USARTS; i++)
+    {
+        if ( (Address >= (uintptr_t)SimUsarts[i]) && (Address < ((uintptr_t)SimUsarts[i] + 0x400U)) )
+        {
+            Sim_UsartAccess(i, Access);
+            return;
+        }
+    }
+    for (U32 i = 0; i < SIM_NOF_DMAS; i++)
+    {
+        if ( (Address >= (uintptr_t)SimDmas[i]) && (Address < ((uintptr_t)SimDmas[i] + 0x400U)) )
+        {
+            Sim_DmaAccess(i, Access);
+            return;
+        }
+    }
+    for (U32 i = 0; i < SIM_NOF_GPIO_PORTS; i++)
+    {
+        if ( (Address >= (uintptr_t)SimGpioPorts[i]) && (Address < ((uintptr_t)SimGpioPorts[i] + 0x400U)) )
+        {
+            Sim_GpioAccess(i, Access);
+            return;
+        }
+    }
+    if ( (Address >= CRC_BASE) && (Address < (CRC_BASE + 0x400U)) ) { Sim_CrcAccess(Access); }
+    else if ( (Address >= RCC_BASE) && (Address < (RCC_BASE + 0x400U)) ) { Sim_RccAccess(Access); }
+    else if ( (Address >= NVIC_BASE) && (Address < (NVIC_BASE + 0x200U)) ) { Sim_NvicAccess(Access); }
+    else if ( (Address == (uintptr_t)&DWT->CTRL) && Access->IsWrite ) { Sim_UpdateCycleCounter(); }
+    else if ( (Address == (uintptr_t)&DWT->CYCCNT) && Access->IsWrite )
+    {
+        SimCycleBase = SIM_REGS(DWT_Type, DWT)->CYCCNT;
+        clock_gettime(CLOCK_MONOTONIC, &SimCycleBaseTime);
+    }
+}
+
+/**
+ * @brief Check if the line of the given interrupt is asserted by a simulated peripheral.
+ * @param Irq Interrupt number.
+ * @return True = asserted, False = deasserted.
+ */
+static Bool Sim_IrqLevel(IRQn_Type Irq)
+{
+    for (U32 i = 0; i < SIM_NOF_USARTS; i++)
+    {
+        if (SimUsartIrqs[i] == Irq) { return Sim_UsartIrqLevel(SIM_REGS(USART_TypeDef, SimUsarts[i])); }
+    }
+    for (U32 Dma = 0; Dma < SIM_NOF_DMAS; Dma++)
+    {
+        for (U32 Channel = 0; Channel < SIM_NOF_DMA_CHANNELS; Channel++)
+        {
+            if (SimDmaIrqs[Dma][Channel] == Irq) { return Sim_DmaIrqLevel(Dma, Channel); }
+        }
+    }
+    return False;
+}
+
+/**
+ * @brief Find the enabled & pending interrupt of highest priority.
+ * @return Interrupt number, -1 if none.
+ */
+static S32 Sim_NextInterrupt(void)
+{
+    const NVIC_Type* const Regs = SIM_REGS(NVIC_Type, NVIC);
+    S32 Next = -1;
+    for (U32 Irq = 0; Irq < SIM_NOF_IRQS; Irq++)
+    {
+        const U32 Bit = 1UL << (Irq & 0x1FU);
+        if (!(SimNvicEnabled[Irq >> 5U] & Bit)) { continue; }
+        if ( !(SimNvicPending[Irq >> 5U] & Bit) && !Sim_IrqLevel((IRQn_Type)Irq) ) { continue; }
+        if ( (Next < 0) || (Regs->IP[Irq] < Regs->IP[Next]) ) { Next = (S32)Irq; }
+    }
+    return Next;
+}
+
+/**
+ * @brief Register access trap, entered before the access. Makes the page accessible
+ *        & single-steps the accessing instruction.
+ */
+static void Sim_SegvHandler(int Signal, siginfo_t* Info, void* Context)
+{
+    ucontext_t* const Uc = (ucontext_t*)Context;
+    const uintptr_t Address = (uintptr_t)Info->si_addr;
+    if (Sim_Alias((const void*)Address) == NULL)
+    {
+        /* Not a simulated register, fault again without the simulator */
+        fprintf(stderr, "sim: invalid access at %p\n", Info->si_addr);
+        signal(Signal, SIG_DFL);
+        return;
+    }
+
+    SimAccess.Address = Address;
+    SimAccess.IsWrite = (Uc->uc_mcontext.gregs[REG_ERR] & SIM_PAGE_FAULT_WRITE) != 0;
+    SimAccess.Size = SimAccess.IsWrite ? Sim_DecodeStoreSize((const U8*)Uc->uc_mcontext.gregs[REG_RIP]) : 4U;
+    SimAccess.OldValue = Sim_ReadWord(Address);
+    if ( !SimAccess.IsWrite && ((Address & ~(uintptr_t)3U) == (uintptr_t)&DWT->CYCCNT) ) { Sim_UpdateCycleCounter(); }
+
+    (void)mprotect((void*)(Address & ~(SIM_PAGE_SIZE - 1U)), SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    Uc->uc_mcontext.gregs[REG_EFL] |= SIM_EFLAGS_TRAP;
+}
+
+/**
+ * @brief Single-step trap, entered after the access. Revokes access to the page & lets
+ *        the peripheral models react, taking interrupts raised by the access.
+ */
+static void Sim_TrapHandler(int Signal, siginfo_t* Info, void* Context)
+{
+    UNUSED(Signal);
+    UNUSED(Info);
+    ucontext_t* const Uc = (ucontext_t*)Context;
+    Uc->uc_mcontext.gregs[REG_EFL] &= ~SIM_EFLAGS_TRAP;
+
+    const Sim_AccessType Access = SimAccess;
+    (void)mprotect((void*)(Access.Address & ~(SIM_PAGE_SIZE - 1U)), SIM_PAGE_SIZE, PROT_NONE);
+    SimNofAccesses++;
+    Sim_PeripheralAccess(&Access);
+    Sim_DmaService();
+    Sim_ServiceInterrupts();
+}
+
+/**
+ * @brief Put all simulated registers to their reset values.
+ */
+static void Sim_Reset(void)
+{
+    for (U32 i = 0; i < (sizeof(SimRegions) / sizeof(SimRegions[0])); i++)
+    {
+        memset(SimRegions[i].Alias, 0, SimRegions[i].Size);
+    }
+    for (U32 i = 0; i < SIM_NOF_USARTS; i++)
+    {
+        SIM_REGS(USART_TypeDef, SimUsarts[i])->ISR = USART_ISR_TXE | USART_ISR_TC;
+        SimCaptures[i].Count = 0U;
+        memset(&SimShifters[i], 0, sizeof(SimShifters[i]));
+    }
+    for (U32 i = 0; i < SIM_NOF_GPIO_PORTS; i++)
+    {
+        GPIO_TypeDef* const Regs = SIM_REGS(GPIO_TypeDef, SimGpioPorts[i]);
+        Regs->MODER = (i == 0U) ? 0xABFFFFFFUL : ((i == 1U) ? 0xFFFFFEBFUL : 0xFFFFFFFFUL);
+        Regs->PUPDR = (i == 0U) ? 0x64000000UL : ((i == 1U) ? 0x00000100UL : 0x00000000UL);
+        SimGpioInputs[i] = 0U;
+        SimGpioDriven[i] = 0U;
+        Sim_GpioUpdateInputs(i);
+    }
+    CRC_TypeDef* const CrcRegs = SIM_REGS(CRC_TypeDef, CRC);
+    CrcRegs->DR = 0xFFFFFFFFUL;
+    CrcRegs->INIT = 0xFFFFFFFFUL;
+    CrcRegs->POL = 0x04C11DB7UL;
+    SimCrc = 0xFFFFFFFFUL;
+    SIM_REGS(RCC_TypeDef, RCC)->CR = RCC_CR_MSION | RCC_CR_MSIRDY | RCC_CR_MSIRANGE_6;
+    memset(SimDmaStates, 0, sizeof(SimDmaStates));
+    memset(SimNvicEnabled, 0, sizeof(SimNvicEnabled));
+    memset(SimNvicPending, 0, sizeof(SimNvicPending));
+    clock_gettime(CLOCK_MONOTONIC, &SimCycleBaseTime);
+    SimCycleBase = 0U;
+    SimIrqMasked = False;
+    SimInHandler = False;
+    SimExclusive = False;
+    SimNofAccesses = 0U;
+}
+
+/* -------------------------- Public function definitions -------------------------- */
+
+void Sim_Init(void)
+{
+    for (U32 i = 0; i < (sizeof(SimRegions) / sizeof(SimRegions[0])); i++)
+    {
+        Sim_RegionType* const Region = &SimRegions[i];
+        const int Fd = memfd_create("sim", 0);
+        if ( (Fd < 0) || (ftruncate(Fd, (off_t)Region->Size) != 0) ) { perror("sim: memfd"); exit(EXIT_FAILURE); }
+
+        void* const Trap = mmap((void*)Region->Base, Region->Size, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, Fd, 0);
+        Region->Alias = mmap(NULL, Region->Size, PROT_READ | PROT_WRITE, MAP_SHARED, Fd, 0);
+        if ( (Trap != (void*)Region->Base) || (Region->Alias == MAP_FAILED) ) { perror("sim: mmap"); exit(EXIT_FAILURE); }
+        (void)close(Fd);
+    }
+    Sim_Reset();
+
+    /* Handlers may nest, interrupt handlers run inside the trap handler */
+    struct sigaction Action;
+    memset(&Action, 0, sizeof(Action));
+    Action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    Action.sa_sigaction = Sim_SegvHandler;
+    (void)sigaction(SIGSEGV, &Action, NULL);
+    Action.sa_sigaction = Sim_TrapHandler;
+    (void)sigaction(SIGTRAP, &Action, NULL);
+}
+
+U16 Sim_UsartReceive(USART_TypeDef* Usart, const U8* Data, U16 Length)
+{
+    U32 Index = 0U;
+    while ( (Index < SIM_NOF_USARTS) && (SimUsarts[Index] != Usart) ) { Index++; }
+    if (Index == SIM_NOF_USARTS) { return 0U; }
+
+    USART_TypeDef* const Regs = SIM_REGS(USART_TypeDef, Usart);
+    U16 NofReceived = 0U;
+    for (U16 i = 0; i < Length; i++)
+    {
+        if ( !(Regs->CR1 & USART_CR1_UE) || !(Regs->CR1 & USART_CR1_RE) ) { continue; }
+
+        Regs->ISR &= ~USART_ISR_IDLE;
+        if (Regs->ISR & USART_ISR_RXNE)
+        {
+            Regs->ISR |= USART_ISR_ORE;
+        }
+        else
+        {
+            Regs->RDR = Data[i];
+            Regs->ISR |= USART_ISR_RXNE;
+            NofReceived++;
+        }
+        if (Data[i] == (U8)(Regs->CR2 >> USART_CR2_ADD_Pos)) { Regs->ISR |= USART_ISR_CMF; }
+        Sim_DmaService();
+        Sim_ServiceInterrupts();
+    }
+
+    Regs->ISR |= USART_ISR_IDLE;
+    Sim_ServiceInterrupts();
+    return NofReceived;
+}
+
+void Sim_UsartSetCharacterDelay(USART_TypeDef* Usart, Bool Delayed)
+{
+    for (U32 i = 0; i < SIM_NOF_USARTS; i++)
+    {
+        if (SimUsarts[i] != Usart) { continue; }
+        while (SimShifters[i].Shifting) { Sim_UsartShift(); }
+        SimShifters[i].Delayed = Delayed;
+    }
+}
+
+U16 Sim_UsartTransmitted(USART_TypeDef* Usart, U8* Data, U16 MaxLength)
+{
+    U32 Index = 0U;
+    while ( (Index < SIM_NOF_USARTS) && (SimUsarts[Index] != Usart) ) { Index++; }
+    if (Index == SIM_NOF_USARTS) { return 0U; }
+
+    Sim_CaptureType* const Capture = &SimCaptures[Index];
+    const U32 Count = (Capture->Count < MaxLength) ? Capture->Count : MaxLength;
+    if (Data != NULL) { memcpy(Data, Capture->Data, Count); }
+    memmove(Capture->Data, &Capture->Data[Count], Capture->Count - Count);
+    Capture->Count -= Count;
+    return (U16)Count;
+}
+
+void Sim_GpioSetInput(GPIO_TypeDef* Port, U8 Pin, Bool Level)
+{
+    for (U32 i = 0; i < SIM_NOF_GPIO_PORTS; i++)
+    {
+        if (SimGpioPorts[i] != Port) { continue; }
+        SimGpioDriven[i] |= (U16)(1U << Pin);
+        if (Level) { SimGpioInputs[i] |= (U16)(1U << Pin); }
+        else       { SimGpioInputs[i] &= (U16)~(1U << Pin); }
+        Sim_GpioUpdateInputs(i);
+    }
+}
+
+void Sim_SetCoreClock(U32 Frequency_Hz)
+{
+    Sim_UpdateCycleCounter();
+    SimCycleBase = SIM_REGS(DWT_Type, DWT)->CYCCNT;
+    clock_gettime(CLOCK_MONOTONIC, &SimCycleBaseTime);
+    SimCoreClock_Hz = Frequency_Hz;
+}
+
+U32 Sim_GetNofAccesses(void)
+{
+    return SimNofAccesses;
+}
+
+void Sim_ServiceInterrupts(void)
+{
+    if (SimIrqMasked || SimInHandler) { return; }
+    SimInHandler = True;
+
+    U32 NofRuns = 0U;
+    for (S32 Irq = Sim_NextInterrupt(); Irq >= 0; Irq = Sim_NextInterrupt())
+    {
+        if (++NofRuns > SIM_MAX_HANDLER_RUNS)
+        {
+            fprintf(stderr, "sim: interrupt %d keeps firing, flag left uncleared?\n", (int)Irq);
+            abort();
+        }
+
+        Sim_NvicBit(SimNvicPending, (IRQn_Type)Irq, False);
+        Sim_NvicPublish();
+        SimExclusive = False;
+
+        const uintptr_t Vtor = SIM_REGS(SCB_Type, SCB)->VTOR;
+        const uintptr_t* const Table = (Vtor != 0U) ? (const uintptr_t*)Vtor : (const uintptr_t*)&VectorTable;
+        const Irq_HandlerType Handler = (Irq_HandlerType)Table[(U32)Irq + SIM_IRQ_VECTOR_OFFSET];
+        if (Handler == NULL)
+        {
+            fprintf(stderr, "sim: no handler installed for interrupt %d\n", (int)Irq);
+            abort();
+        }
+        Handler();
+        Sim_DmaService();
+    }
+
+    SimInHandler = False;
+}
+
+/* ------------------------------ Simulator core hooks ----------------------------- */
+
+void Sim_DisableIrq(void)
+{
+    SimIrqMasked = True;
+}
+
+void Sim_EnableIrq(void)
+{
+    SimIrqMasked = False;
+    Sim_ServiceInterrupts();
+}
+
+void Sim_Idle(void)
+{
+    Sim_UsartShift();
+    Sim_DmaService();
+    Sim_ServiceInterrupts();
+}
+
+uint8_t Sim_LoadExclusiveByte(volatile uint8_t* Address)
+{
+    SimExclusive = True;
+    return *Address;
+}
+
+uint32_t Sim_StoreExclusiveByte(uint8_t Value, volatile uint8_t* Address)
+{
+    if (!SimExclusive) { return 1U; }
+    *Address = Value;
+    SimExclusive = False;
+    return 0U;
+}
+
+void Sim_ClearExclusive(void)
+{
+    SimExclusive = False;
+}
+
+void Sim_NvicDisableIrq(IRQn_Type Irq)
+{
+    NVIC->ICER[(U32)Irq >> 5U] = (1UL << ((U32)Irq & 0x1FU));
+}
@@ -0,0 +1,103 @@
+/**
+ * @file sim.h
+ *
+ * @brief Host register-level peripheral simulator.
+ *
+ *        The peripheral & core register blocks are mapped at their STM32L476 addresses
+ *        in the address space of the test runner, so the peripheral macros of the device
+ *        header (USART2, DMA1_Channel1, CRC, GPIOA, NVIC...) point at simulated registers
+ *        & drivers run unmodified. Every register access traps into the simulator, which
+ *        models the behavior of the peripheral:
+ *        - USART: TXE/TC/RXNE/IDLE/CMF flags, transmitted data capture & received data injection,
+ *          optionally a one character delay between the data & shift registers.
+ *        - DMA: channel requests, transfer counters, circular mode, half/complete/error flags.
+ *        - CRC: polynomial size, input & output reversal.
+ *        - GPIO: ODR/BSRR/BRR & IDR reflecting outputs or injected input levels.
+ *        - RCC: oscillator & PLL ready flags, system clock switch status.
+ *        - NVIC & DWT: interrupt enable/pending state & the cycle counter.
+ *
+ *        Interrupt handlers installed in the vector table pointed to by SCB->VTOR are
+ *        invoked once an enabled interrupt is pending & interrupts are not masked,
+ *        right after the register access raising it, when interrupts are re-enabled
+ *        or in __NOP()/__WFI() busy loops. Handlers do not preempt each other.
+ *
+ * @note Requires Linux on x86-64. Runners must be linked with -no-pie so that buffers
+ *       accessed by DMA have 32-bit addresses, buffers on the stack cannot be used by DMA.
+ *       Each register access costs a few microseconds of host time, benchmark results are
+ *       best compared as number of register accesses, see Sim_GetNofAccesses().
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#include "typedef.h"
+#include "stm32l4xx.h"
+
+/* ---------------------------- Preprocessor directives ---------------------------- */
+#define SIM_USART_CAPTURE_SIZE      (4096U)
+#define SIM_DEFAULT_CORE_CLOCK_Hz   (80000000U)
+
+/* -------------------------- Public function declarations ------------------------- */
+
+/**
+ * @brief Map the simulated register blocks at their reset values & install the access traps.
+ *        Must be called once, before any register access.
+ */
+void Sim_Init(void);
+
+/**
+ * @brief Receive data on the given USART as if sent by the remote end, interrupts & DMA
+ *        requests are serviced after each byte. The line goes idle afterwards.
+ * @param Usart Pointer to USART peripheral structure.
+ * @param Data Received data.
+ * @param Length Number of bytes.
+ * @return Number of bytes received, bytes arriving while the receiver is disabled are lost
+ *         & bytes arriving while the previous one is unread cause an overrun.
+ */
+U16 Sim_UsartReceive(USART_TypeDef* Usart, const U8* Data, U16 Length);
+
+/**
+ * @brief Delay transmission on the given USART by one character time: a character written
+ *        to the data register moves to the shift register & leaves the line at the next idle
+ *        step (__NOP()/__WFI()), TXE & TC follow. Without delay characters leave at once.
+ * @param Usart Pointer to USART peripheral structure.
+ * @param Delayed True = delayed, False = shifted out at once. Characters in flight are sent first.
+ */
+void Sim_UsartSetCharacterDelay(USART_TypeDef* Usart, Bool Delayed);
+
+/**
+ * @brief Read & discard the data transmitted by the given USART.
+ * @param Usart Pointer to USART peripheral structure.
+ * @param Data Where to store transmitted data, may be NULL to only discard.
+ * @param MaxLength Maximum number of bytes to read.
+ * @return Number of bytes read.
+ */
+U16 Sim_UsartTransmitted(USART_TypeDef* Usart, U8* Data, U16 MaxLength);
+
+/**
+ * @brief Drive an input pin of the given GPIO port. Undriven inputs follow their pull resistor.
+ * @param Port Pointer to GPIO port structure.
+ * @param Pin Pin number.
+ * @param Level True = high, False = low.
+ */
+void Sim_GpioSetInput(GPIO_TypeDef* Port, U8 Pin, Bool Level);
+
+/**
+ * @brief Set the core clock frequency the DWT cycle counter counts at, host time is used.
+ * @param Frequency_Hz Core clock frequency.
+ */
+void Sim_SetCoreClock(U32 Frequency_Hz);
+
+/**
+ * @brief Get the number of register accesses since Sim_Init().
+ * @return Number of register accesses.
+ */
+U32 Sim_GetNofAccesses(void);
+
+/**
+ * @brief Invoke the handlers of pending interrupts, unless interrupts are masked.
+ */
+void Sim_ServiceInterrupts(void);
+
+#endif /* SIM_H */
@@ -0,0 +1,59 @@
+/**
+ * @file stm32l4xx.h
+ *
+ * @brief Host build of the device header for the peripheral simulator, shadows the
+ *        device header of the target build when the simulator directory is searched first.
+ *        Peripheral & core register blocks keep their addresses, see sim.h. Core
+ *        instructions without a host equivalent are replaced by simulator hooks.
+ */
+
+#ifndef SIM_STM32L4XX_H
+#define SIM_STM32L4XX_H
+
+/* ------------------------------- Include directives ------------------------------ */
+#if !defined(STM32L476xx)
+#define STM32L476xx
+#endif /* STM32L476xx */
+#include <stdint.h>
+/* CMSIS vector accessors cast VTOR to a pointer, not used by the drivers */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wint-to-pointer-cast"
+#include "stm32l476xx.h"
+#pragma GCC diagnostic pop
+
+/* ------------------------------ Simulator core hooks ----------------------------- */
+
+void Sim_DisableIrq(void);
+void Sim_EnableIrq(void);
+void Sim_Idle(void);
+uint8_t Sim_LoadExclusiveByte(volatile uint8_t* Address);
+uint32_t Sim_StoreExclusiveByte(uint8_t Value, volatile uint8_t* Address);
+void Sim_ClearExclusive(void);
+void Sim_NvicDisableIrq(IRQn_Type Irq);
+
+/* ------------------------------ Intrinsic overrides ------------------------------ */
+#undef __disable_irq
+#undef __enable_irq
+#undef __NOP
+#undef __WFI
+#undef __DSB
+#undef __ISB
+#undef __DMB
+#undef __LDREXB
+#undef __STREXB
+#undef __CLREX
+#undef NVIC_DisableIRQ
+
+#define __disable_irq()             Sim_DisableIrq()
+#define __enable_irq()              Sim_EnableIrq()
+#define __NOP()                     Sim_Idle()
+#define __WFI()                     Sim_Idle()
+#define __DSB()                     __sync_synchronize()
+#define __ISB()                     __sync_synchronize()
+#define __DMB()                     __sync_synchronize()
+#define __LDREXB(Address)           Sim_LoadExclusiveByte(Address)
+#define __STREXB(Value, Address)    Sim_StoreExclusiveByte(Value, Address)
+#define __CLREX()                   Sim_ClearExclusive()
+#define NVIC_DisableIRQ(Irq)        Sim_NvicDisableIrq(Irq)
+
+#endif /* SIM_STM32L4XX_H */
@@ -11,7 +11,8 @@ void setUp(void)
 {
     for (U16 i = 0; i < UNIT_TEST_BUFFER_SIZE; i++)
     {
-        EncodeBuffer[i] = 0;
+        /* Non-zero fill, every encoded byte has to be written by the encoder */
+        EncodeBuffer[i] = 0xA5;
         DecodeBuffer[i] = 0;
     }
     return;
@@ -309,6 +310,44 @@ void Test_CodecHandlesNullPointers(void)
     TEST_ASSERT_EQUAL_UINT32(ExpectedSize, Result.Length);
 }
 
+void Test_CodecShortFrameAfterLongFrame(void)
+{
+    U8 LongPayload[] = { 0x00, 0x0A, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x5A };
+    U16 LongPayloadSize = (U16)(sizeof(LongPayload) / sizeof(LongPayload[0]));
+    U8 ShortPayload[] = { 0x01, 0x00, 0x77 };
+    U16 ShortPayloadSize = (U16)(sizeof(ShortPayload) / sizeof(ShortPayload[0]));
+    U8 Expected[] = { 0x02, 0x01, 0x02, 0x77, 0x00 };
+    U16 ExpectedSize = (U16)(sizeof(Expected) / sizeof(Expected[0]));
+
+    CobsCodec_ResultType LongResult = CobsCodec_Encode(LongPayload, LongPayloadSize, EncodeBuffer, UNIT_TEST_BUFFER_SIZE);
+    TEST_ASSERT_TRUE(LongResult.Valid);
+    TEST_ASSERT_EQUAL_UINT8(0x00, EncodeBuffer[LongResult.Length - 1U]);
+
+    CobsCodec_ResultType EncodeResult = CobsCodec_Encode(ShortPayload, ShortPayloadSize, EncodeBuffer, UNIT_TEST_BUFFER_SIZE);
+    CobsCodec_ResultType DecodeResult = CobsCodec_Decode(EncodeBuffer, EncodeResult.Length, DecodeBuffer, UNIT_TEST_BUFFER_SIZE);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Expected, EncodeBuffer, ExpectedSize);
+    TEST_ASSERT_EQUAL_UINT32(ExpectedSize, EncodeResult.Length);
+    TEST_ASSERT_TRUE(EncodeResult.Valid);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ShortPayload, DecodeBuffer, DecodeResult.Length);
+    TEST_ASSERT_EQUAL_UINT32(ShortPayloadSize, DecodeResult.Length);
+    TEST_ASSERT_TRUE(DecodeResult.Valid);
+}
+
+void Test_CodecRejectsTooSmallBuffer(void)
+{
+    U8 Payload[] = { 0x11, 0x22, 0x33, 0x44 };
+    U16 PayloadSize = (U16)(sizeof(Payload) / sizeof(Payload[0]));
+
+    /* Exactly the encoded length fits, one byte less leaves no room for the delimiter */
+    CobsCodec_ResultType Result = CobsCodec_Encode(Payload, PayloadSize, EncodeBuffer, PayloadSize + 2U);
+    TEST_ASSERT_TRUE(Result.Valid);
+    TEST_ASSERT_EQUAL_UINT32(PayloadSize + 2U, Result.Length);
+
+    Result = CobsCodec_Encode(Payload, PayloadSize, EncodeBuffer, PayloadSize + 1U);
+    TEST_ASSERT_FALSE(Result.Valid);
+    TEST_ASSERT_EQUAL_UINT32(0UL, Result.Length);
+}
 
 int main(void)
 {
@@ -326,6 +365,8 @@ int main(void)
     RUN_TEST(Test_CodecExample10);
     RUN_TEST(Test_CodecExample11);
     RUN_TEST(Test_CodecHandlesNullPointers);
+    RUN_TEST(Test_CodecShortFrameAfterLongFrame);
+    RUN_TEST(Test_CodecRejectsTooSmallBuffer);
 
     return UNITY_END();
 }
@@ -130,6 +130,103 @@ void Test_WrapAround(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(Expected, Results, 8);
 }
 
+void Test_CommitWriteWrapsAround(void)
+{
+    U8 Dummy = 0;
+    U8 Results[4] = { 0 };
+    U8 Expected[4] = { 0x01, 0x02, 0x03, 0x04 };
+
+    for (U8 i = 0; i < 6; i++)
+    {
+        Fifo_WriteByte(&TestFifo, 0xFF);
+        Fifo_ReadByte(&TestFifo, &Dummy);
+    }
+
+    /* Emulate DMA writing past the end of the buffer. */
+    TestArray[6] = 0x01;
+    TestArray[7] = 0x02;
+    TestArray[0] = 0x03;
+    TestArray[1] = 0x04;
+    TEST_ASSERT_EQUAL(0, Fifo_CommitWrite(&TestFifo, 4));
+    TEST_ASSERT_EQUAL(4, Fifo_GetNofItems(&TestFifo));
+
+    for (U8 i = 0; i < 4; i++)
+    {
+        Fifo_ReadByte(&TestFifo, &Results[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Expected, Results, 4);
+    TEST_ASSERT_EQUAL(True, Fifo_Empty(&TestFifo));
+}
+
+void Test_CommitWriteOverflowDiscardsOldest(void)
+{
+    U8 Data = 0;
+
+    for (U8 i = 0; i < 6; i++)
+    {
+        Fifo_WriteByte(&TestFifo, i);
+    }
+    TEST_ASSERT_EQUAL(4, Fifo_CommitWrite(&TestFifo, 6));
+    TEST_ASSERT_EQUAL(True, Fifo_Full(&TestFifo));
+
+    /* Head caught up with the oldest unread byte, which now is the one at index 4. */
+    Fifo_ReadByte(&TestFifo, &Data);
+    TEST_ASSERT_EQUAL(4, Data);
+}
+
+void Test_ContiguousItemsStopAtWrapAround(void)
+{
+    U8 Dummy = 0;
+
+    for (U8 i = 0; i < 6; i++)
+    {
+        Fifo_WriteByte(&TestFifo, i);
+    }
+    for (U8 i = 0; i < 4; i++)
+    {
+        Fifo_ReadByte(&TestFifo, &Dummy);
+    }
+    TEST_ASSERT_EQUAL(2, Fifo_GetNofContiguousItems(&TestFifo));
+
+    for (U8 i = 0; i < 4; i++)
+    {
+        Fifo_WriteByte(&TestFifo, 0xAA);
+    }
+    TEST_ASSERT_EQUAL(6, Fifo_GetNofItems(&TestFifo));
+    TEST_ASSERT_EQUAL(4, Fifo_GetNofContiguousItems(&TestFifo));
+
+    /* Emulate DMA reading the first span, the remainder starts at the buffer start. */
+    Fifo_CommitRead(&TestFifo, Fifo_GetNofContiguousItems(&TestFifo));
+    TEST_ASSERT_EQUAL(2, Fifo_GetNofItems(&TestFifo));
+    TEST_ASSERT_EQUAL(2, Fifo_GetNofContiguousItems(&TestFifo));
+    Fifo_ReadByte(&TestFifo, &Dummy);
+    TEST_ASSERT_EQUAL(0xAA, Dummy);
+}
+
+void Test_BufferLargerThan255Bytes(void)
+{
+    static U8 LargeArray[1024];
+    FifoType LargeFifo;
+    U8 Data = 0;
+
+    Fifo_Init(&LargeFifo, LargeArray, sizeof(LargeArray));
+    for (U16 i = 0; i < 1000; i++)
+    {
+        Fifo_WriteByte(&LargeFifo, (U8)i);
+    }
+    TEST_ASSERT_EQUAL(1000, Fifo_GetNofItems(&LargeFifo));
+    TEST_ASSERT_EQUAL(24, Fifo_GetNofAvailable(&LargeFifo));
+
+    Fifo_CommitRead(&LargeFifo, 300);
+    Fifo_ReadByte(&LargeFifo, &Data);
+    TEST_ASSERT_EQUAL((U8)300, Data);
+
+    /* Wrap around past the end of the buffer. */
+    TEST_ASSERT_EQUAL(0, Fifo_CommitWrite(&LargeFifo, 300));
+    TEST_ASSERT_EQUAL(999, Fifo_GetNofItems(&LargeFifo));
+    TEST_ASSERT_EQUAL(723, Fifo_GetNofContiguousItems(&LargeFifo));
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -139,6 +236,10 @@ int main(void)
     RUN_TEST(Test_OverrunProtection);
     RUN_TEST(Test_ClearFifo);
     RUN_TEST(Test_WrapAround);
+    RUN_TEST(Test_CommitWriteWrapsAround);
+    RUN_TEST(Test_CommitWriteOverflowDiscardsOldest);
+    RUN_TEST(Test_ContiguousItemsStopAtWrapAround);
+    RUN_TEST(Test_BufferLargerThan255Bytes);
 
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,219 @@
+/**
+ * @file test_memory_routines.c
+ *
+ * @brief Unit tests for memory routines module.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+
+#include "memory_routines.h"
+#include "unity.h"
+
+/* ------------------------------- Unit test variables ----------------------------- */
+
+#define UNIT_TEST_BUFFER_SIZE   (128U)
+#define UNIT_TEST_MAX_OFFSET    (4U)
+#define UNIT_TEST_GUARD_BYTE    (0xA5U)
+
+static U8 SrcBuffer[UNIT_TEST_BUFFER_SIZE] ALIGN(4) = { 0 };
+static U8 DstBuffer[UNIT_TEST_BUFFER_SIZE] ALIGN(4) = { 0 };
+static U8 RefBuffer[UNIT_TEST_BUFFER_SIZE] ALIGN(4) = { 0 };
+
+/* ----------------------------- Unit test helpers --------------------------------- */
+
+/**
+ * @brief Bytewise reference implementation of memmove.
+ */
+static void RefMove(U8* Dst, const U8* Src, size_t Count)
+{
+    U8 Tmp[UNIT_TEST_BUFFER_SIZE];
+    for (size_t i = 0; i < Count; i++) { Tmp[i] = Src[i]; }
+    for (size_t i = 0; i < Count; i++) { Dst[i] = Tmp[i]; }
+}
+
+/**
+ * @brief Fill the given buffer with a non-repeating pattern.
+ */
+static void FillPattern(U8* Buffer, size_t Count, U8 Seed)
+{
+    for (size_t i = 0; i < Count; i++) { Buffer[i] = (U8)((i * 7U) + Seed); }
+}
+
+/**
+ * @brief Fill the given buffer with guard bytes.
+ */
+static void FillGuard(U8* Buffer, size_t Count)
+{
+    for (size_t i = 0; i < Count; i++) { Buffer[i] = UNIT_TEST_GUARD_BYTE; }
+}
+
+/* --------------------------- Setup & teardown functions -------------------------- */
+
+void setUp(void)
+{
+    FillPattern(SrcBuffer, UNIT_TEST_BUFFER_SIZE, 0x11U);
+    FillGuard(DstBuffer, UNIT_TEST_BUFFER_SIZE);
+    FillGuard(RefBuffer, UNIT_TEST_BUFFER_SIZE);
+}
+
+void tearDown(void)
+{
+
+}
+
+/* ----------------------------------- Test cases ---------------------------------- */
+
+void Test_MemcpyAllSizesAndAlignments(void)
+{
+    for (U32 SrcOffset = 0; SrcOffset < UNIT_TEST_MAX_OFFSET; SrcOffset++)
+    {
+        for (U32 DstOffset = 0; DstOffset < UNIT_TEST_MAX_OFFSET; DstOffset++)
+        {
+            for (U32 Count = 0; Count < (UNIT_TEST_BUFFER_SIZE - (2U * UNIT_TEST_MAX_OFFSET)); Count++)
+            {
+                FillGuard(DstBuffer, UNIT_TEST_BUFFER_SIZE);
+                FillGuard(RefBuffer, UNIT_TEST_BUFFER_SIZE);
+                RefMove(&RefBuffer[DstOffset], &SrcBuffer[SrcOffset], Count);
+
+                void* RetVal = memcpy(&DstBuffer[DstOffset], &SrcBuffer[SrcOffset], Count);
+                TEST_ASSERT_TRUE(RetVal == &DstBuffer[DstOffset]);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(RefBuffer, DstBuffer, UNIT_TEST_BUFFER_SIZE);
+            }
+        }
+    }
+}
+
+void Test_MemsetAllSizesAndAlignments(void)
+{
+    for (U32 Offset = 0; Offset < UNIT_TEST_MAX_OFFSET; Offset++)
+    {
+        for (U32 Count = 0; Count < (UNIT_TEST_BUFFER_SIZE - UNIT_TEST_MAX_OFFSET); Count++)
+        {
+            FillGuard(DstBuffer, UNIT_TEST_BUFFER_SIZE);
+            FillGuard(RefBuffer, UNIT_TEST_BUFFER_SIZE);
+            for (U32 i = 0; i < Count; i++) { RefBuffer[Offset + i] = 0x3CU; }
+
+            void* RetVal = memset(&DstBuffer[Offset], 0x3C, Count);
+            TEST_ASSERT_TRUE(RetVal == &DstBuffer[Offset]);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(RefBuffer, DstBuffer, UNIT_TEST_BUFFER_SIZE);
+        }
+    }
+}
+
+void Test_MemsetTruncatesFillValueToByte(void)
+{
+    memset(DstBuffer, -1, 16U);
+    memset(&DstBuffer[16], 0x1FF, 16U);
+    for (U32 i = 0; i < 32U; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0xFFU, DstBuffer[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(UNIT_TEST_GUARD_BYTE, DstBuffer[32]);
+}
+
+void Test_MemmoveOverlappingForward(void)
+{
+    /* Destination below source, region overlaps. */
+    for (U32 Shift = 1; Shift < 9U; Shift++)
+    {
+        for (U32 Count = 0; Count < (UNIT_TEST_BUFFER_SIZE - 16U); Count++)
+        {
+            FillPattern(DstBuffer, UNIT_TEST_BUFFER_SIZE, 0x22U);
+            FillPattern(RefBuffer, UNIT_TEST_BUFFER_SIZE, 0x22U);
+            RefMove(&RefBuffer[1], &RefBuffer[1U + Shift], Count);
+
+            void* RetVal = memmove(&DstBuffer[1], &DstBuffer[1U + Shift], Count);
+            TEST_ASSERT_TRUE(RetVal == &DstBuffer[1]);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(RefBuffer, DstBuffer, UNIT_TEST_BUFFER_SIZE);
+        }
+    }
+}
+
+void Test_MemmoveOverlappingBackward(void)
+{
+    /* Destination above source, region overlaps. */
+    for (U32 Shift = 1; Shift < 9U; Shift++)
+    {
+        for (U32 Count = 0; Count < (UNIT_TEST_BUFFER_SIZE - 16U); Count++)
+        {
+            FillPattern(DstBuffer, UNIT_TEST_BUFFER_SIZE, 0x33U);
+            FillPattern(RefBuffer, UNIT_TEST_BUFFER_SIZE, 0x33U);
+            RefMove(&RefBuffer[2U + Shift], &RefBuffer[2], Count);
+
+            void* RetVal = memmove(&DstBuffer[2U + Shift], &DstBuffer[2], Count);
+            TEST_ASSERT_TRUE(RetVal == &DstBuffer[2U + Shift]);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(RefBuffer, DstBuffer, UNIT_TEST_BUFFER_SIZE);
+        }
+    }
+}
+
+void Test_MemmoveNonOverlapping(void)
+{
+    RefMove(RefBuffer, &SrcBuffer[3], 100U);
+    memmove(DstBuffer, &SrcBuffer[3], 100U);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(RefBuffer, DstBuffer, UNIT_TEST_BUFFER_SIZE);
+}
+
+void Test_MemcmpEqualBuffers(void)
+{
+    memcpy(DstBuffer, SrcBuffer, UNIT_TEST_BUFFER_SIZE);
+    for (U32 Offset = 0; Offset < UNIT_TEST_MAX_OFFSET; Offset++)
+    {
+        TEST_ASSERT_EQUAL(0, memcmp(&DstBuffer[Offset], &SrcBuffer[Offset], UNIT_TEST_BUFFER_SIZE - Offset));
+    }
+    TEST_ASSERT_EQUAL(0, memcmp(DstBuffer, SrcBuffer, 0U));
+}
+
+void Test_MemcmpLocatesFirstMismatch(void)
+{
+    for (U32 Offset = 0; Offset < UNIT_TEST_MAX_OFFSET; Offset++)
+    {
+        for (U32 Mismatch = 0; Mismatch < 40U; Mismatch++)
+        {
+            FillPattern(SrcBuffer, UNIT_TEST_BUFFER_SIZE, 0x11U);
+            memcpy(DstBuffer, SrcBuffer, UNIT_TEST_BUFFER_SIZE);
+            SrcBuffer[Offset + Mismatch] = 0x10U;
+            DstBuffer[Offset + Mismatch] = 0x20U;
+            SrcBuffer[Offset + Mismatch + 1U] = 0xF0U;
+            DstBuffer[Offset + Mismatch + 1U] = 0x00U;
+
+            TEST_ASSERT_TRUE(memcmp(&DstBuffer[Offset], &SrcBuffer[Offset], 64U) > 0);
+            TEST_ASSERT_TRUE(memcmp(&SrcBuffer[Offset], &DstBuffer[Offset], 64U) < 0);
+            TEST_ASSERT_EQUAL(0, memcmp(&DstBuffer[Offset], &SrcBuffer[Offset], Mismatch));
+        }
+    }
+}
+
+void Test_MemcmpMutuallyMisaligned(void)
+{
+    memcpy(&DstBuffer[1], SrcBuffer, 64U);
+    TEST_ASSERT_EQUAL(0, memcmp(&DstBuffer[1], SrcBuffer, 64U));
+    DstBuffer[50] = 0x00U;
+    SrcBuffer[49] = 0xFFU;
+    TEST_ASSERT_TRUE(memcmp(&DstBuffer[1], SrcBuffer, 64U) < 0);
+}
+
+void Test_MemcmpComparesAsUnsigned(void)
+{
+    DstBuffer[0] = 0x80U;
+    SrcBuffer[0] = 0x7FU;
+    TEST_ASSERT_TRUE(memcmp(DstBuffer, SrcBuffer, 1U) > 0);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(Test_MemcpyAllSizesAndAlignments);
+    RUN_TEST(Test_MemsetAllSizesAndAlignments);
+    RUN_TEST(Test_MemsetTruncatesFillValueToByte);
+    RUN_TEST(Test_MemmoveOverlappingForward);
+    RUN_TEST(Test_MemmoveOverlappingBackward);
+    RUN_TEST(Test_MemmoveNonOverlapping);
+    RUN_TEST(Test_MemcmpEqualBuffers);
+    RUN_TEST(Test_MemcmpLocatesFirstMismatch);
+    RUN_TEST(Test_MemcmpMutuallyMisaligned);
+    RUN_TEST(Test_MemcmpComparesAsUnsigned);
+
+    return UNITY_END();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_protocol.c
+ *
+ * @brief Tests of the protocol message framing, messages are COBS encoded into frames
+ *        ending with a zero delimiter.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+
+#include <string.h>
+#include "unity.h"
+#include "protocol.h"
+#include "msg_handler.h"
+
+/* ------------------------------- Unit test variables ----------------------------- */
+
+static Protocol_MessageType Message;
+static Protocol_MessageType Decoded;
+
+/* --------------------------- Setup & teardown functions -------------------------- */
+
+void setUp(void)
+{
+    memset(&Message, 0x00, sizeof(Message));
+    memset(&Decoded, 0xA5, sizeof(Decoded));
+}
+
+void tearDown(void)
+{
+}
+
+/* ----------------------- Message handler stubs, not exercised -------------------- */
+
+void MsgHandler_HandleMessage(const Protocol_MessageType* RxMsg, Protocol_MessageType* TxMsg)
+{
+    UNUSED(RxMsg);
+    UNUSED(TxMsg);
+}
+
+void MsgHandler_ConstructTelemetry(const U8* SignalIds, U8 NofSignals, Protocol_MessageType* TxMsg)
+{
+    UNUSED(SignalIds);
+    UNUSED(NofSignals);
+    UNUSED(TxMsg);
+}
+
+/* ----------------------------------- Helpers ------------------------------------- */
+
+static void SetMessage(U8 Id, const U8* Payload, U8 Length, U8 Crc)
+{
+    memset(&Message, 0x00, sizeof(Message));
+    Message.Id = Id;
+    Message.Length = Length;
+    memcpy(Message.Payload, Payload, Length);
+    Message.Crc = Crc;
+}
+
+/**
+ * @brief Encode the message, check that the frame holds a single delimiter as its last
+ *        byte & decode it again.
+ */
+static void AssertRoundTrip(void)
+{
+    U16 FrameLength = 0U;
+    const U8* Frame = Protocol_EncodeResponse(&Message, &FrameLength);
+
+    TEST_ASSERT_TRUE(FrameLength > 0U);
+    TEST_ASSERT_TRUE(FrameLength <= MSG_FRAME_SIZE);
+    TEST_ASSERT_EQUAL_UINT8(MSG_FRAME_DELIMITER, Frame[FrameLength - 1U]);
+    TEST_ASSERT_NULL(memchr(Frame, MSG_FRAME_DELIMITER, FrameLength - 1U));
+
+    TEST_ASSERT_TRUE(Protocol_DecodeRequest(Frame, FrameLength, &Decoded));
+    TEST_ASSERT_EQUAL_UINT8(Message.Id, Decoded.Id);
+    TEST_ASSERT_EQUAL_UINT8(Message.Length, Decoded.Length);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Message.Payload, Decoded.Payload, MSG_PAYLOAD_SIZE);
+    TEST_ASSERT_EQUAL_UINT8(Message.Crc, Decoded.Crc);
+}
+
+/* ---------------------------------- Unit tests ----------------------------------- */
+
+void Test_ProtocolRoundTripEmptyPayload(void)
+{
+    SetMessage(NACK_RESPONSE, NULL, 0U, 0x77U);
+    AssertRoundTrip();
+}
+
+void Test_ProtocolRoundTripPayloadWithZeros(void)
+{
+    static const U8 Payload[] = { 0x0AU, 0x00U, 0x00U, 0x00U, 0x01U, 0x02U, 0x03U, 0x00U };
+    SetMessage(ACK_RESPONSE, Payload, sizeof(Payload), 0x00U);
+    AssertRoundTrip();
+}
+
+void Test_ProtocolRoundTripMaximumPayload(void)
+{
+    U8 Payload[MSG_PAYLOAD_SIZE];
+    for (U16 i = 0U; i < MSG_PAYLOAD_SIZE; i++) { Payload[i] = (U8)(i + 1U); }
+    SetMessage(TELEMETRY_RESPONSE, Payload, MSG_PAYLOAD_SIZE, 0x5AU);
+    AssertRoundTrip();
+}
+
+void Test_ProtocolShortResponseAfterLongResponse(void)
+{
+    static const U8 Payload[] = { 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U };
+    static const U8 Expected[] = { 0x02U, 0x01U, 0x02U, 0x77U, 0x00U };
+
+    SetMessage(ACK_RESPONSE, Payload, sizeof(Payload), 0x5AU);
+    AssertRoundTrip();
+
+    /* The frame buffer is reused, no byte of the longer frame may remain */
+    SetMessage(NACK_RESPONSE, NULL, 0U, 0x77U);
+    U16 FrameLength = 0U;
+    const U8* Frame = Protocol_EncodeResponse(&Message, &FrameLength);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(Expected), FrameLength);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(Expected, Frame, sizeof(Expected));
+    AssertRoundTrip();
+}
+
+void Test_ProtocolRejectsCorruptedFrames(void)
+{
+    /* Length field claims more payload bytes than the frame holds */
+    static const U8 LengthMismatch[] = { 0x05U, 0x01U, 0x03U, 0x11U, 0x77U, 0x00U };
+    TEST_ASSERT_FALSE(Protocol_DecodeRequest(LengthMismatch, sizeof(LengthMismatch), &Decoded));
+
+    /* Missing delimiter */
+    static const U8 Unterminated[] = { 0x02U, 0x01U, 0x02U, 0x77U };
+    TEST_ASSERT_FALSE(Protocol_DecodeRequest(Unterminated, sizeof(Unterminated), &Decoded));
+
+    /* Shorter than header & CRC */
+    static const U8 Truncated[] = { 0x02U, 0x01U, 0x00U };
+    TEST_ASSERT_FALSE(Protocol_DecodeRequest(Truncated, sizeof(Truncated), &Decoded));
+
+    /* Exceeds the frame buffer */
+    U8 Oversized[MSG_FRAME_SIZE + 1U];
+    memset(Oversized, 0x01U, sizeof(Oversized));
+    Oversized[MSG_FRAME_SIZE] = MSG_FRAME_DELIMITER;
+    TEST_ASSERT_FALSE(Protocol_DecodeRequest(Oversized, sizeof(Oversized), &Decoded));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(Test_ProtocolRoundTripEmptyPayload);
+    RUN_TEST(Test_ProtocolRoundTripPayloadWithZeros);
+    RUN_TEST(Test_ProtocolRoundTripMaximumPayload);
+    RUN_TEST(Test_ProtocolShortResponseAfterLongResponse);
+    RUN_TEST(Test_ProtocolRejectsCorruptedFrames);
+
+    return UNITY_END();
+}
@@ -0,0 +1,310 @@
+/**
+ * @file test_sim_drivers.c
+ *
+ * @brief Tests of drivers running against the register-level peripheral simulator.
+ */
+
+/* ------------------------------- Include directives ------------------------------ */
+
+#include <string.h>
+#include "unity.h"
+#include "sim.h"
+#include "irq.h"
+#include "crc.h"
+#include "digital.h"
+#include "dma.h"
+#include "uart.h"
+
+/* ------------------------------- Unit test variables ----------------------------- */
+
+/* Accessed by DMA, must have 32-bit addresses */
+static U8 Source[300];
+static U8 Destination[300];
+static U8 RxData[64];
+static volatile Bool MemcpyDone = False;
+static volatile ReturnCodeEnum MemcpyStatus = RC_ERROR;
+
+static const Digital_OutputType Led =
+{
+    .PortPin = PIN_A5,
+    .OutputType = PIN_OUT_TYPE_PUSH_PULL,
+    .Speed = PIN_SPEED_LOW,
+    .InitVal = DIGITAL_STATE_LOW
+};
+
+static const Digital_InputType Button =
+{
+    .PortPin = PIN_C13,
+    .Resistor = PIN_RES_PULL_UP
+};
+
+static Uart_HandleType Uart = NULL;
+static U32 UartTxTotal = 0U;    /* Bytes written to the output buffer, locates its wrap-around. */
+
+/* --------------------------- Setup & teardown functions -------------------------- */
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* -------------------------------- Helper functions ------------------------------- */
+
+static void MemcpyCallback(void* Dest, ReturnCodeEnum Status)
+{
+    UNUSED(Dest);
+    MemcpyStatus = Status;
+    MemcpyDone = True;
+}
+
+static Uart_HandleType GetUart(void)
+{
+    if (Uart == NULL)
+    {
+        const Uart_ConfigType UartCfg =
+        {
+            .BaudRate = 115200U,
+            .Oversampling = UART_OVERSAMPLING_16,
+            .SamplingMethod = UART_SAMPLING_3_BITS,
+            .Parity = UART_PARITY_NONE,
+            .WordLength = UART_WORD_LEN_8,
+            .StopBits = UART_STOP_BITS_1,
+            .RxPin = PIN_A3,
+            .TxPin = PIN_A2,
+            .RxMode = UART_TRANSFER_MODE_DMA,
+            .TxMode = UART_TRANSFER_MODE_DMA
+        };
+        Uart = Uart_Init(USART2, &UartCfg);
+        Uart_TxEnable(Uart);
+        Uart_RxEnable(Uart);
+        Uart_Enable(Uart);
+    }
+    return Uart;
+}
+
+static void UartTransmit(Uart_HandleType Handle, const U8* Data, U16 Length)
+{
+    TEST_ASSERT_TRUE(Uart_Transmit(Handle, Data, Length));
+    UartTxTotal += Length;
+}
+
+static void UartAwaitLineIdle(void)
+{
+    while (Uart_GetNofOutputBufferBytes(GetUart()) > 0U) { __WFI(); }
+    while (!(USART2->ISR & USART_ISR_TC)) { __WFI(); }
+}
+
+/* ----------------------------------- Test cases ---------------------------------- */
+
+void Test_CrcSAEJ1850(void)
+{
+    const U8 Data[] = "123456789";
+    Crc_Enable();
+    const Crc_Crc8ConfigType Config = Crc_GetSAEJ1850Config();
+    Crc_Crc8Init(&Config);
+    TEST_ASSERT_EQUAL_HEX8(0x4B, Crc_CalcCrc8(Data, 9U));
+}
+
+void Test_DigitalOutputDrivesPin(void)
+{
+    Digital_OutputInit(&Led);
+    TEST_ASSERT_EQUAL_HEX32(0x0U, GPIOA->ODR & GPIO_ODR_OD5);
+
+    Digital_Set(&Led);
+    TEST_ASSERT_EQUAL_HEX32(GPIO_ODR_OD5, GPIOA->ODR & GPIO_ODR_OD5);
+    Digital_Toggle(&Led);
+    TEST_ASSERT_EQUAL_HEX32(0x0U, GPIOA->ODR & GPIO_ODR_OD5);
+    Digital_Toggle(&Led);
+    Digital_Clear(&Led);
+    TEST_ASSERT_EQUAL_HEX32(0x0U, GPIOA->ODR & GPIO_ODR_OD5);
+}
+
+void Test_DigitalInputReadsDrivenLevel(void)
+{
+    Digital_InputInit(&Button);
+    TEST_ASSERT_TRUE(Digital_Read(&Button));
+
+    Sim_GpioSetInput(GPIOC, 13U, False);
+    TEST_ASSERT_FALSE(Digital_Read(&Button));
+    Sim_GpioSetInput(GPIOC, 13U, True);
+    TEST_ASSERT_TRUE(Digital_Read(&Button));
+}
+
+void Test_DmaMemcpy(void)
+{
+    for (U32 i = 0; i < sizeof(Source); i++) { Source[i] = (U8)(i * 7U); }
+    memset(Destination, 0, sizeof(Destination));
+
+    Dma_Init();
+    TEST_ASSERT_EQUAL(RC_OK, Dma_Memcpy(Destination, Source, sizeof(Source)));
+    TEST_ASSERT_EQUAL_MEMORY(Source, Destination, sizeof(Source));
+}
+
+void Test_DmaMemcpyAsyncInvokesCallback(void)
+{
+    for (U32 i = 0; i < sizeof(Source); i++) { Source[i] = (U8)~i; }
+
+    Dma_Init();
+    MemcpyDone = False;
+    TEST_ASSERT_EQUAL(RC_OK, Dma_MemcpyAsync(Destination, Source, sizeof(Source), MemcpyCallback));
+    while (!MemcpyDone) { __WFI(); }
+    TEST_ASSERT_EQUAL(RC_OK, MemcpyStatus);
+    TEST_ASSERT_TRUE(Dma_MemcpyIsIdle());
+    TEST_ASSERT_EQUAL_MEMORY(Source, Destination, sizeof(Source));
+}
+
+void Test_DmaMemcpyAsyncZeroLengthSkipsCallback(void)
+{
+    Dma_Init();
+    MemcpyDone = False;
+    TEST_ASSERT_EQUAL(RC_OK, Dma_MemcpyAsync(Destination, Source, 0U, MemcpyCallback));
+    Sim_ServiceInterrupts();
+    TEST_ASSERT_FALSE(MemcpyDone);
+    TEST_ASSERT_TRUE(Dma_MemcpyIsIdle());
+}
+
+void Test_DmaClaimedChannelRejectsOtherOwner(void)
+{
+    static const U8 OwnerA = 0U;
+    static const U8 OwnerB = 0U;
+
+    Dma_Init();
+    Dma_HandleType Handle = Dma_GetHandle(DMA_INSTANCE_1, DMA_CHANNEL_1);
+    TEST_ASSERT_EQUAL(RC_OK, Dma_ClaimChannel(Handle, &OwnerA));
+    TEST_ASSERT_EQUAL(RC_ERROR, Dma_ClaimChannel(Handle, &OwnerB));
+    TEST_ASSERT_EQUAL(RC_ERROR, Dma_ReleaseChannel(Handle, &OwnerB));
+    TEST_ASSERT_EQUAL(RC_OK, Dma_ReleaseChannel(Handle, &OwnerA));
+    TEST_ASSERT_EQUAL(RC_OK, Dma_ClaimChannel(Handle, &OwnerB));
+    TEST_ASSERT_EQUAL(RC_OK, Dma_ReleaseChannel(Handle, &OwnerB));
+}
+
+void Test_UartTransmitReachesLine(void)
+{
+    static const Char Message[] = "Hello, simulator!";
+    U8 Line[sizeof(Message)] = { 0 };
+    Uart_HandleType Handle = GetUart();
+    (void)Sim_UsartTransmitted(USART2, NULL, SIM_USART_CAPTURE_SIZE);
+
+    UartTransmit(Handle, (const U8*)Message, sizeof(Message) - 1U);
+    UartAwaitLineIdle();
+    TEST_ASSERT_EQUAL(sizeof(Message) - 1U, Sim_UsartTransmitted(USART2, Line, sizeof(Line)));
+    TEST_ASSERT_EQUAL_MEMORY(Message, Line, sizeof(Message) - 1U);
+}
+
+void Test_UartDmaSpanFollowedByShortTail(void)
+{
+    /* DMA span up to the end of the output buffer, the tail after the wrap-around is sent by interrupt */
+    static const U8 SpanLength = UART_DMA_TX_THRESHOLD + 4U;
+    static const U8 TailLength = UART_DMA_TX_THRESHOLD - 3U;
+    static U8 Pattern[UART_TX_BUFFER_SIZE];
+    static U8 Line[UART_TX_BUFFER_SIZE];
+    for (U32 i = 0; i < sizeof(Pattern); i++) { Pattern[i] = (U8)(i + 1U); }
+    Uart_HandleType Handle = GetUart();
+    Sim_UsartSetCharacterDelay(USART2, True);
+
+    const U16 Fill = (U16)((UART_TX_BUFFER_SIZE - SpanLength - (UartTxTotal % UART_TX_BUFFER_SIZE)) % UART_TX_BUFFER_SIZE);
+    if (Fill > 0U)
+    {
+        UartTransmit(Handle, Pattern, Fill);
+        UartAwaitLineIdle();
+    }
+    (void)Sim_UsartTransmitted(USART2, NULL, SIM_USART_CAPTURE_SIZE);
+
+    UartTransmit(Handle, Pattern, SpanLength + TailLength);
+    UartAwaitLineIdle();
+    TEST_ASSERT_EQUAL(SpanLength + TailLength, Sim_UsartTransmitted(USART2, Line, sizeof(Line)));
+    TEST_ASSERT_EQUAL_MEMORY(Pattern, Line, SpanLength + TailLength);
+
+    /* Short transmission while the last byte of a DMA burst is still in the data register */
+    UartTransmit(Handle, Pattern, UART_DMA_TX_THRESHOLD);
+    while (Uart_GetNofOutputBufferBytes(Handle) > 0U) { __WFI(); }
+    UartTransmit(Handle, &Pattern[UART_DMA_TX_THRESHOLD], TailLength);
+    UartAwaitLineIdle();
+    TEST_ASSERT_EQUAL(UART_DMA_TX_THRESHOLD + TailLength, Sim_UsartTransmitted(USART2, Line, sizeof(Line)));
+    TEST_ASSERT_EQUAL_MEMORY(Pattern, Line, UART_DMA_TX_THRESHOLD + TailLength);
+
+    Sim_UsartSetCharacterDelay(USART2, False);
+}
+
+void Test_UartBaudRateSwitchAwaitsTransmission(void)
+{
+    static const U8 Message[] = { 0x11U, 0x22U, 0x33U, 0x44U };
+    U8 Line[sizeof(Message)] = { 0 };
+    Uart_HandleType Handle = GetUart();
+    const U32 InitialBrr = USART2->BRR;
+    Sim_UsartSetCharacterDelay(USART2, True);
+    (void)Sim_UsartTransmitted(USART2, NULL, SIM_USART_CAPTURE_SIZE);
+
+    UartTransmit(Handle, Message, sizeof(Message));
+    TEST_ASSERT_EQUAL(RC_OK, Uart_SetBaudRate(Handle, 9600U, NULL));
+    TEST_ASSERT_TRUE(Uart_IsBaudRateSwitchPending(Handle));
+    TEST_ASSERT_EQUAL_HEX32(InitialBrr, USART2->BRR);
+
+    while (Uart_IsBaudRateSwitchPending(Handle)) { __WFI(); }
+    TEST_ASSERT_TRUE(USART2->BRR != InitialBrr);
+    TEST_ASSERT_EQUAL(sizeof(Message), Sim_UsartTransmitted(USART2, Line, sizeof(Line)));
+    TEST_ASSERT_EQUAL_MEMORY(Message, Line, sizeof(Message));
+
+    /* Idle line, applied at once */
+    TEST_ASSERT_EQUAL(RC_OK, Uart_SetBaudRate(Handle, 115200U, NULL));
+    TEST_ASSERT_FALSE(Uart_IsBaudRateSwitchPending(Handle));
+    TEST_ASSERT_EQUAL_HEX32(InitialBrr, USART2->BRR);
+    Sim_UsartSetCharacterDelay(USART2, False);
+}
+
+void Test_UartRejectsInvalidCallerBuffers(void)
+{
+    static U8 Buffer[100];
+    static const U16 InvalidSizes[] = { 0U, 100U, 48U, 0xFFFFU };
+    for (U8 i = 0; i < (sizeof(InvalidSizes) / sizeof(InvalidSizes[0])); i++)
+    {
+        Uart_ConfigType UartCfg = { .BaudRate = 115200U, .RxPin = PIN_A3, .TxPin = PIN_A2 };
+        UartCfg.TxBuffer = Buffer;
+        UartCfg.TxBufferSize = InvalidSizes[i];
+        TEST_ASSERT_NULL(Uart_Init(USART2, &UartCfg));
+
+        UartCfg.TxBuffer = NULL;
+        UartCfg.RxBuffer = Buffer;
+        UartCfg.RxBufferSize = InvalidSizes[i];
+        TEST_ASSERT_NULL(Uart_Init(USART2, &UartCfg));
+    }
+}
+
+void Test_UartReceiveFromLine(void)
+{
+    static const U8 Message[] = { 0x01U, 0x02U, 0x00U, 0xFFU, 0x55U, 0xAAU };
+    Uart_HandleType Handle = GetUart();
+    Uart_RxBufferClear(Handle);
+
+    TEST_ASSERT_EQUAL(sizeof(Message), Sim_UsartReceive(USART2, Message, sizeof(Message)));
+    TEST_ASSERT_EQUAL(sizeof(Message), Uart_GetNofInputBufferBytes(Handle));
+    TEST_ASSERT_TRUE(Uart_Recieve(Handle, RxData, sizeof(Message)));
+    TEST_ASSERT_EQUAL_MEMORY(Message, RxData, sizeof(Message));
+    TEST_ASSERT_EQUAL(0U, Uart_GetErrorCount(Handle, UART_ERROR_OVERRUN));
+}
+
+int main(void)
+{
+    Sim_Init();
+    Irq_Init();
+
+    UNITY_BEGIN();
+
+    RUN_TEST(Test_CrcSAEJ1850);
+    RUN_TEST(Test_DigitalOutputDrivesPin);
+    RUN_TEST(Test_DigitalInputReadsDrivenLevel);
+    RUN_TEST(Test_DmaMemcpy);
+    RUN_TEST(Test_DmaMemcpyAsyncInvokesCallback);
+    RUN_TEST(Test_DmaMemcpyAsyncZeroLengthSkipsCallback);
+    RUN_TEST(Test_DmaClaimedChannelRejectsOtherOwner);
+    RUN_TEST(Test_UartTransmitReachesLine);
+    RUN_TEST(Test_UartDmaSpanFollowedByShortTail);
+    RUN_TEST(Test_UartBaudRateSwitchAwaitsTransmission);
+    RUN_TEST(Test_UartRejectsInvalidCallerBuffers);
+    RUN_TEST(Test_UartReceiveFromLine);
+
+    return UNITY_END();
+}
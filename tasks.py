@@ -16,6 +16,7 @@ PATHS = {
     "test_dir": Path("stm32l476rg/test"),
     "test_build_dir": Path("stm32l476rg/test/build"),
     "test_results": Path("stm32l476rg/test/build/results.txt"),
+    "benchmark_results": Path("stm32l476rg/test/build/benchmark.txt"),
 }
 
 DEVICE_INFO = {
@@ -128,3 +129,10 @@ def test(ctx: Context) -> None:
     with ctx.cd(PATHS["test_dir"]):
         ctx.run("make clean")
     sys.exit(return_code)
+
+
+@task
+def benchmark(ctx: Context) -> None:
+    """Build & run native benchmarks."""
+    with ctx.cd(PATHS["test_dir"]):
+        ctx.run("make benchmark")